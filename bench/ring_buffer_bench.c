@@ -0,0 +1,688 @@
+/**
+ * \file ring_buffer_bench.c
+ * \brief 环形缓冲性能测试程序，每项结果输出一行 JSON，便于持续集成中记录与比较
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+ *
+ * 编译(在仓库根目录):
+ *     make bench          生成 ring_buffer_bench
+ *     make bench-copy     定义 RING_BUFFER_USE_COPY_KERNEL，生成 ring_buffer_bench_copy，rb_large 同时输出 memcpy 与非临时存储两组结果
+ *     make tsan           以 -fsanitize=thread 编译并运行 spsc_wait、mpmc_stress、shard_stress
+ * 运行:
+ *     ./ring_buffer_bench [--quick] [--filter 名称前缀]
+ *     ./ring_buffer_bench_copy --filter rb_large
+*/
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "ring_buffer.h"
+#include "ring_buffer_chapter.h"
+#include "ring_buffer_spsc.h"
+#include "ring_buffer_mpmc.h"
+#include "ring_buffer_shard.h"
+#include "ring_buffer_copy.h"
+
+#define BENCH_BUFFER_SIZE       (64 * 1024)         //单线程测试使用的缓冲区大小
+#define BENCH_MAX_TRANSFER      (16 * 1024)         //单次传输的最大长度
+#define BENCH_LATENCY_SAMPLES   (1 << 16)           //跨线程延迟采样数量
+#define BENCH_LARGE_RING        (512u * 1024 * 1024) //大块传输测试的缓冲区大小，需大于末级缓存
+#define BENCH_LARGE_MAX         (4u * 1024 * 1024)  //大块传输的最大长度
+#define BENCH_HOT_SIZE          (1024 * 1024)       //大块传输之间访问的热数据大小，用于衡量缓存污染
+
+static uint32_t bench_scale = 1 ;                   //迭代次数缩放，--quick 时减小
+static const char *bench_filter = NULL ;            //只运行名称以此为前缀的测试
+static volatile uint8_t bench_sink ;                //防止读出的数据被编译器优化掉
+
+static uint8_t bench_buffer[BENCH_BUFFER_SIZE];
+static uint8_t bench_input[BENCH_MAX_TRANSFER];
+static uint8_t bench_output[BENCH_MAX_TRANSFER];
+
+//获取单调时钟的纳秒数
+static uint64_t Bench_Now(void)
+{
+    struct timespec ts ;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec ;
+}
+
+//判断测试是否需要运行
+static int Bench_Enabled(const char *name)
+{
+    return bench_filter == NULL || strncmp(name, bench_filter, strlen(bench_filter)) == 0 ;
+}
+
+//按初始化模式初始化缓冲区，mode 为 "arbitrary" 或 "pow2"
+static void Bench_Init(ring_buffer *rb, const char *mode, uint32_t size)
+{
+    if(strcmp(mode, "pow2") == 0)
+        RB_Init_Pow2(rb, bench_buffer, size);
+    else
+        RB_Init(rb, bench_buffer, size);
+}
+
+//单字节读写：写一个字节再读一个字节为一次操作
+static void Bench_Byte(const char *mode)
+{
+    ring_buffer rb ;
+    uint8_t data ;
+    uint64_t iterations = 20000000ull / bench_scale ;
+    Bench_Init(&rb, mode, BENCH_BUFFER_SIZE);
+    //先填入一半数据，让读写指针在整个数组上循环
+    for(uint32_t i = 0; i < BENCH_BUFFER_SIZE / 2; i++)
+        RB_Write_Byte(&rb, (uint8_t)i);
+    uint64_t start = Bench_Now();
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        RB_Write_Byte(&rb, (uint8_t)i);
+        RB_Read_Byte(&rb, &data);
+        bench_sink ^= data ;
+    }
+    uint64_t elapsed = Bench_Now() - start ;
+    printf("{\"bench\":\"rb_byte\",\"mode\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.3f}\n",
+           mode, (unsigned long long)iterations, (double)elapsed / (double)iterations);
+}
+
+//定长读写：wrap 为1时每次传输都跨越数组末尾，为0时总是从数组开头开始，每次循环读写指针都回到同一位置
+static void Bench_String(const char *mode, uint32_t size, int wrap)
+{
+    ring_buffer rb ;
+    uint64_t bytes = 2000000000ull / bench_scale ;
+    uint64_t iterations = bytes / size + 1 ;
+    if(iterations > 20000000ull / bench_scale)
+        iterations = 20000000ull / bench_scale ;
+    uint32_t ring_size = BENCH_BUFFER_SIZE ;
+    Bench_Init(&rb, mode, ring_size);
+    if(wrap)
+    {
+        //让读写指针停在距离数组末尾 size/2 的位置，之后每次传输都会被拆成两段
+        RB_Write_Commit(&rb, ring_size - size / 2);
+        RB_Delete(&rb, ring_size - size / 2);
+    }
+    uint64_t start = Bench_Now();
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        RB_Write_String(&rb, bench_input, size);
+        RB_Read_String(&rb, bench_output, size);
+        //再推进 ring_size - size 字节，使每次传输都从同一位置开始
+        RB_Write_Commit(&rb, ring_size - size);
+        RB_Delete(&rb, ring_size - size);
+        bench_sink ^= bench_output[0];
+    }
+    uint64_t elapsed = Bench_Now() - start ;
+    printf("{\"bench\":\"rb_string\",\"mode\":\"%s\",\"size\":%u,\"wrap\":%d,\"iterations\":%llu,"
+           "\"ns_per_op\":%.3f,\"mb_per_s\":%.1f}\n",
+           mode, size, wrap, (unsigned long long)iterations, (double)elapsed / (double)iterations,
+           (double)size * 2 * (double)iterations * 1000.0 / (double)elapsed);
+}
+
+//分段读写：写入、结尾、读出为一次循环
+static void Bench_Chapter(uint32_t size)
+{
+    static uint32_t chapter_buffer[1024];
+    ring_buffer_chapter rbc ;
+    uint32_t Length ;
+    uint64_t iterations = 10000000ull / bench_scale ;
+    RBC_Init(&rbc, bench_buffer, BENCH_BUFFER_SIZE, chapter_buffer, sizeof(chapter_buffer));
+    uint64_t start = Bench_Now();
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        RBC_Write_String(&rbc, bench_input, size);
+        RBC_Ending_Chapter(&rbc);
+        RBC_Read_Chapter(&rbc, bench_output, &Length);
+        bench_sink ^= bench_output[0];
+    }
+    uint64_t elapsed = Bench_Now() - start ;
+    printf("{\"bench\":\"rbc_cycle\",\"size\":%u,\"iterations\":%llu,\"ns_per_op\":%.3f}\n",
+           size, (unsigned long long)iterations, (double)elapsed / (double)iterations);
+}
+
+//分段批量删除：写满 number 个分段后一次删除，统计每次删除的耗时
+static void Bench_Chapter_Delete(uint32_t size, uint32_t number)
+{
+    static uint32_t chapter_buffer[4096];
+    ring_buffer_chapter rbc ;
+    uint64_t rounds = 200000ull / bench_scale ;
+    uint64_t elapsed = 0 ;
+    RBC_Init(&rbc, bench_buffer, BENCH_BUFFER_SIZE, chapter_buffer, sizeof(chapter_buffer));
+    for(uint64_t r = 0; r < rounds; r++)
+    {
+        for(uint32_t i = 0; i < number; i++)
+        {
+            RBC_Write_String(&rbc, bench_input, size);
+            RBC_Ending_Chapter(&rbc);
+        }
+        uint64_t start = Bench_Now();
+        RBC_Delete(&rbc, number);
+        elapsed += Bench_Now() - start ;
+    }
+    printf("{\"bench\":\"rbc_delete\",\"size\":%u,\"chapters\":%u,\"iterations\":%llu,\"ns_per_op\":%.3f}\n",
+           size, number, (unsigned long long)rounds, (double)elapsed / (double)rounds);
+}
+
+//大块传输：缓冲区保持半满，写入的数据要在半个缓冲区之后才被读出，与深缓冲的数据流相同；
+//写入与读出分别计时，每次传输后遍历一遍热数据，hot_ns 反映传输把多少热数据挤出了缓存；
+//read 为0时以删除代替读出，模拟消费者位于其他核心时生产者一侧的缓存，hot_ns 只反映写入造成的污染
+static void Bench_Large(uint8_t *large_buffer, uint8_t *input, uint8_t *output, uint8_t *hot,\
+                        const char *kernel, uint32_t threshold, uint32_t size, uint8_t read)
+{
+    ring_buffer rb ;
+    uint64_t iterations = (8000000000ull / bench_scale) / size + 1 ;
+    uint64_t write_elapsed = 0, read_elapsed = 0, hot_elapsed = 0 ;
+#ifdef RING_BUFFER_USE_COPY_KERNEL
+    RB_Set_Copy_Threshold(threshold);
+#else
+    (void)threshold ;
+#endif
+    RB_Init_Pow2(&rb, large_buffer, BENCH_LARGE_RING);
+    RB_Write_Commit(&rb, BENCH_LARGE_RING / 2);
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        uint64_t t0 = Bench_Now();
+        RB_Write_String(&rb, input, size);
+        uint64_t t1 = Bench_Now();
+        if(read)
+            RB_Read_String(&rb, output, size);
+        else
+            RB_Delete(&rb, size);
+        uint64_t t2 = Bench_Now();
+        //各次读取互不依赖，耗时取决于热数据所在的缓存层级，而不是对 bench_sink 的串行写入
+        uint8_t hot_sum = 0 ;
+        for(uint32_t j = 0; j < BENCH_HOT_SIZE; j += 64)
+            hot_sum ^= hot[j];
+        hot_elapsed += Bench_Now() - t2 ;
+        bench_sink ^= hot_sum ;
+        write_elapsed += t1 - t0 ;
+        read_elapsed += t2 - t1 ;
+        bench_sink ^= output[size - 1];
+    }
+    printf("{\"bench\":\"rb_large\",\"kernel\":\"%s\",\"consumer\":\"%s\",\"size\":%u,\"iterations\":%llu,"
+           "\"write_mb_per_s\":%.1f,\"read_mb_per_s\":%.1f,\"hot_ns\":%.1f}\n",
+           kernel, read ? "read" : "delete", size, (unsigned long long)iterations,
+           (double)size * (double)iterations * 1000.0 / (double)write_elapsed,
+           read ? (double)size * (double)iterations * 1000.0 / (double)read_elapsed : 0.0,
+           (double)hot_elapsed / (double)iterations);
+}
+
+//大块传输测试入口，未定义 RING_BUFFER_USE_COPY_KERNEL 时只有 memcpy 一组结果
+static void Bench_Large_All(void)
+{
+    static const uint32_t large_sizes[] = {64 * 1024, 256 * 1024, 1024 * 1024, BENCH_LARGE_MAX};
+    uint8_t *large_buffer = malloc(BENCH_LARGE_RING);
+    uint8_t *input = malloc(BENCH_LARGE_MAX);
+    uint8_t *output = malloc(BENCH_LARGE_MAX);
+    uint8_t *hot = malloc(BENCH_HOT_SIZE);
+    if(!large_buffer || !input || !output || !hot)
+    {
+        fprintf(stderr, "rb_large: out of memory\n");
+        free(large_buffer); free(input); free(output); free(hot);
+        return ;
+    }
+    //预先触碰所有页面，避免缺页计入第一组结果
+    memset(large_buffer, 0, BENCH_LARGE_RING);
+    memset(input, 0x5a, BENCH_LARGE_MAX);
+    memset(output, 0, BENCH_LARGE_MAX);
+    memset(hot, 1, BENCH_HOT_SIZE);
+    for(uint8_t read = 1; read <= 1; read--)
+        for(uint32_t s = 0; s < sizeof(large_sizes) / sizeof(large_sizes[0]); s++)
+        {
+            Bench_Large(large_buffer, input, output, hot, "memcpy", UINT32_MAX, large_sizes[s], read);
+#ifdef RING_BUFFER_USE_COPY_KERNEL
+            Bench_Large(large_buffer, input, output, hot, "stream", 0, large_sizes[s], read);
+#endif
+        }
+#ifdef RING_BUFFER_USE_COPY_KERNEL
+    RB_Set_Copy_Threshold(RB_COPY_THRESHOLD);
+#endif
+    free(large_buffer);
+    free(input);
+    free(output);
+    free(hot);
+}
+
+//跨线程测试的共享状态
+static ring_buffer_spsc bench_spsc ;
+static uint8_t bench_spsc_buffer[BENCH_BUFFER_SIZE];
+static uint64_t bench_spsc_bytes ;
+static uint32_t bench_spsc_size ;
+
+//生产者线程：每条消息开头写入发送时刻，用于计算延迟
+static void *Bench_Producer(void *arg)
+{
+    (void)arg ;
+    uint8_t message[BENCH_MAX_TRANSFER] = {0};
+    for(uint64_t sent = 0; sent < bench_spsc_bytes; sent += bench_spsc_size)
+    {
+        uint64_t now = Bench_Now();
+        memcpy(message, &now, sizeof(now));
+        while(!RBS_Write_String(&bench_spsc, message, bench_spsc_size))
+        {
+            sched_yield();
+            now = Bench_Now();
+            memcpy(message, &now, sizeof(now));
+        }
+    }
+    return NULL ;
+}
+
+static int Bench_Compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b ;
+    return (x > y) - (x < y) ;
+}
+
+//跨线程吞吐量与延迟：一个生产者线程与一个消费者线程通过无锁缓冲区传输定长消息
+static void Bench_Spsc(uint32_t size)
+{
+    static uint64_t samples[BENCH_LATENCY_SAMPLES];
+    uint8_t message[BENCH_MAX_TRANSFER];
+    pthread_t producer ;
+    uint32_t sample_number = 0 ;
+    bench_spsc_size = size ;
+    bench_spsc_bytes = (1000000000ull / bench_scale) / size * size ;
+    RBS_Init(&bench_spsc, bench_spsc_buffer, sizeof(bench_spsc_buffer));
+    uint64_t start = Bench_Now();
+    pthread_create(&producer, NULL, Bench_Producer, NULL);
+    uint64_t messages = bench_spsc_bytes / size ;
+    uint64_t stride = messages / BENCH_LATENCY_SAMPLES + 1 ;
+    for(uint64_t received = 0; received < messages; received++)
+    {
+        while(!RBS_Read_String(&bench_spsc, message, size))
+            sched_yield();
+        if(received % stride == 0 && sample_number < BENCH_LATENCY_SAMPLES)
+        {
+            uint64_t sent ;
+            memcpy(&sent, message, sizeof(sent));
+            samples[sample_number++] = Bench_Now() - sent ;
+        }
+    }
+    uint64_t elapsed = Bench_Now() - start ;
+    pthread_join(producer, NULL);
+    qsort(samples, sample_number, sizeof(samples[0]), Bench_Compare);
+    printf("{\"bench\":\"spsc_throughput\",\"size\":%u,\"messages\":%llu,\"mb_per_s\":%.1f,"
+           "\"latency_ns_p50\":%llu,\"latency_ns_p99\":%llu,\"latency_ns_p999\":%llu}\n",
+           size, (unsigned long long)messages, (double)bench_spsc_bytes * 1000.0 / (double)elapsed,
+           (unsigned long long)samples[sample_number / 2],
+           (unsigned long long)samples[(uint64_t)sample_number * 99 / 100],
+           (unsigned long long)samples[(uint64_t)sample_number * 999 / 1000]);
+}
+
+#if RING_BUFFER_SPSC_WAIT
+//阻塞等待测试：小缓冲区上两侧交替短暂停顿，使生产者与消费者反复挂起与被唤醒
+#define BENCH_WAIT_BUFFER       256                 //阻塞等待测试的缓冲区大小，容纳8条消息
+#define BENCH_WAIT_MESSAGE      32                  //阻塞等待测试的消息长度
+#define BENCH_WAIT_TIMEOUT      1000                //单次等待的超时(ms)，对方一直在读写，超时说明错过了唤醒
+
+static ring_buffer_spsc bench_wait ;
+static uint8_t bench_wait_buffer[BENCH_WAIT_BUFFER];
+static uint64_t bench_wait_messages ;
+static uint64_t bench_wait_timeouts ;               //生产者侧等待超时次数
+
+//短暂停顿，时长超过自旋等待，让对方进入挂起
+static void Bench_Pause(void)
+{
+    struct timespec ts = {0, 20000};
+    nanosleep(&ts, NULL);
+}
+
+//阻塞等待测试的生产者线程：按顺序写入带序号的消息，每条分4次发布，
+//消费者等待整条消息时会被多次唤醒并重新置位等待标志；每64条停顿一次
+static void *Bench_Wait_Producer(void *arg)
+{
+    (void)arg ;
+    uint8_t message[BENCH_WAIT_MESSAGE] = {0};
+    for(uint64_t sequence = 0; sequence < bench_wait_messages; sequence++)
+    {
+        memcpy(message, &sequence, sizeof(sequence));
+        for(uint32_t offset = 0; offset < sizeof(message); offset += sizeof(message) / 4)
+            while(!RBS_Write_String_Wait(&bench_wait, message + offset, sizeof(message) / 4, BENCH_WAIT_TIMEOUT))
+                bench_wait_timeouts ++ ;
+        if(sequence % 64 == 63)
+            Bench_Pause();
+    }
+    return NULL ;
+}
+
+//阻塞等待的唤醒路径：两侧都开启阻塞模式并交替停顿，统计等待超时与乱序的消息，任一不为0时返回1
+static int Bench_Spsc_Wait(void)
+{
+    uint8_t message[BENCH_WAIT_MESSAGE];
+    pthread_t producer ;
+    uint64_t timeouts = 0, errors = 0 ;
+    bench_wait_messages = 200000 / bench_scale ;
+    bench_wait_timeouts = 0 ;
+    RBS_Init(&bench_wait, bench_wait_buffer, sizeof(bench_wait_buffer));
+    RBS_Set_Blocking(&bench_wait, 1);
+    uint64_t start = Bench_Now();
+    pthread_create(&producer, NULL, Bench_Wait_Producer, NULL);
+    for(uint64_t sequence = 0; sequence < bench_wait_messages; sequence++)
+    {
+        uint64_t received ;
+        while(!RBS_Read_String_Wait(&bench_wait, message, sizeof(message), BENCH_WAIT_TIMEOUT))
+            timeouts ++ ;
+        memcpy(&received, message, sizeof(received));
+        if(received != sequence)
+            errors ++ ;
+        if(sequence % 97 == 96)
+            Bench_Pause();
+    }
+    uint64_t elapsed = Bench_Now() - start ;
+    pthread_join(producer, NULL);
+    timeouts += bench_wait_timeouts ;
+    printf("{\"bench\":\"spsc_wait\",\"messages\":%llu,\"ns_per_message\":%.1f,\"timeouts\":%llu,\"errors\":%llu}\n",
+           (unsigned long long)bench_wait_messages, (double)elapsed / (double)bench_wait_messages,
+           (unsigned long long)timeouts, (unsigned long long)errors);
+    return timeouts != 0 || errors != 0 ;
+}
+#endif
+
+//多生产者多消费者压力测试：小队列上多个生产者与消费者线程并发读写，消息跨越多个槽位并在数组末尾回绕
+#define BENCH_STRESS_PRODUCERS  4                   //压力测试的生产者线程数
+#define BENCH_STRESS_CONSUMERS  3                   //压力测试的消费者线程数
+#define BENCH_STRESS_SLOTS      64                  //队列槽位数量
+#define BENCH_STRESS_SLOT_SIZE  16                  //每个槽位的字节数，消息最多占用3个槽位
+#define BENCH_STRESS_MESSAGE    48                  //消息最大长度
+
+static ring_buffer_mpmc bench_mpmc ;
+static ring_buffer_mpmc_slot bench_mpmc_slots[BENCH_STRESS_SLOTS];
+static uint8_t bench_mpmc_buffer[BENCH_STRESS_SLOTS * BENCH_STRESS_SLOT_SIZE];
+static uint32_t bench_stress_messages ;             //每个生产者发送的消息数量
+static atomic_uint_fast64_t bench_stress_received ; //所有消费者已收到的消息总数
+static atomic_uint_fast64_t bench_stress_errors ;   //内容错误或同一生产者的消息乱序的次数
+static atomic_uint_fast64_t bench_stress_sum[BENCH_STRESS_PRODUCERS]; //每个生产者已收到消息的序号之和
+
+//生成消息：首字节为生产者编号，随后4字节为序号，其余为由两者推出的内容，返回消息长度(5~48)
+static uint32_t Bench_Stress_Fill(uint8_t *message, uint32_t producer, uint32_t sequence)
+{
+    uint32_t length = 5 + sequence * 7 % (BENCH_STRESS_MESSAGE - 4);
+    message[0] = (uint8_t)producer ;
+    memcpy(message + 1, &sequence, sizeof(sequence));
+    for(uint32_t i = 5; i < length; i++)
+        message[i] = (uint8_t)(producer * 31 + sequence + i);
+    return length ;
+}
+
+//校验收到的消息，last 为本消费者收到的每个生产者的上一条序号+1；同一消费者先后领取的位置递增，
+//因此同一生产者的序号也必须递增
+static void Bench_Stress_Check(const uint8_t *message, uint32_t length, uint32_t *last)
+{
+    uint8_t expect[BENCH_STRESS_MESSAGE];
+    uint32_t producer = message[0], sequence ;
+    if(length < 5 || producer >= BENCH_STRESS_PRODUCERS)
+    {
+        atomic_fetch_add(&bench_stress_errors, 1);
+        return ;
+    }
+    memcpy(&sequence, message + 1, sizeof(sequence));
+    if(sequence >= bench_stress_messages || sequence + 1 <= last[producer]
+       || Bench_Stress_Fill(expect, producer, sequence) != length || memcmp(expect, message, length) != 0)
+        atomic_fetch_add(&bench_stress_errors, 1);
+    last[producer] = sequence + 1 ;
+    atomic_fetch_add(&bench_stress_sum[producer], sequence);
+}
+
+//将领取到的分段拷贝到 message，返回长度，超过消息最大长度时返回0(校验时计为错误)
+static uint32_t Bench_Stress_Copy(uint8_t *message, const ring_buffer_region *region)
+{
+    uint32_t length = region->Length_a + region->Length_b ;
+    if(length > BENCH_STRESS_MESSAGE)
+        return 0 ;
+    memcpy(message, region->addr_a, region->Length_a);
+    if(region->Length_b)
+        memcpy(message + region->Length_a, region->addr_b, region->Length_b);
+    return length ;
+}
+
+//清零压力测试的统计，每个生产者发送 messages 条消息
+static void Bench_Stress_Reset(uint32_t messages)
+{
+    bench_stress_messages = messages ;
+    atomic_store(&bench_stress_received, 0);
+    atomic_store(&bench_stress_errors, 0);
+    for(uint32_t i = 0; i < BENCH_STRESS_PRODUCERS; i++)
+        atomic_store(&bench_stress_sum[i], 0);
+}
+
+//汇总压力测试的错误数：每个生产者的消息都恰好收到一次时，序号之和为 0+1+...+(messages-1)
+static uint64_t Bench_Stress_Errors(void)
+{
+    uint64_t errors = atomic_load(&bench_stress_errors);
+    for(uint32_t i = 0; i < BENCH_STRESS_PRODUCERS; i++)
+        if(atomic_load(&bench_stress_sum[i]) != (uint64_t)bench_stress_messages * (bench_stress_messages - 1) / 2)
+            errors ++ ;
+    return errors ;
+}
+
+//压力测试的生产者线程：轮流使用整段写入、分散写入与预留/提交三种接口，队列已满时让出处理器后重试
+static void *Bench_Stress_Producer(void *arg)
+{
+    uint32_t producer = (uint32_t)(uintptr_t)arg ;
+    uint8_t message[BENCH_STRESS_MESSAGE];
+    for(uint32_t sequence = 0; sequence < bench_stress_messages; sequence++)
+    {
+        uint32_t length = Bench_Stress_Fill(message, producer, sequence);
+        if(sequence % 3 == 0)
+        {
+            while(!RBQ_Write_Chapter(&bench_mpmc, message, length))
+                sched_yield();
+        }
+        else if(sequence % 3 == 1)
+        {
+            ring_buffer_vector vector[2] = {{message, 3}, {message + 3, length - 3}};
+            while(!RBQ_Write_Chapter_Vector(&bench_mpmc, vector, 2))
+                sched_yield();
+        }
+        else
+        {
+            ring_buffer_region region ;
+            ring_buffer_mpmc_ticket ticket ;
+            while(!RBQ_Write_Reserve(&bench_mpmc, length, &region, &ticket))
+                sched_yield();
+            memcpy(region.addr_a, message, region.Length_a < length ? region.Length_a : length);
+            if(region.Length_a < length)
+                memcpy(region.addr_b, message + region.Length_a, length - region.Length_a);
+            RBQ_Write_Commit(&bench_mpmc, &ticket, length);
+        }
+    }
+    return NULL ;
+}
+
+//压力测试的消费者线程：轮流使用整段读取与领取/释放两种接口，直到所有消息都被收到
+static void *Bench_Stress_Consumer(void *arg)
+{
+    (void)arg ;
+    uint64_t total = (uint64_t)bench_stress_messages * BENCH_STRESS_PRODUCERS ;
+    uint32_t last[BENCH_STRESS_PRODUCERS] = {0};
+    uint8_t message[BENCH_STRESS_MESSAGE];
+    uint32_t turn = 0 ;
+    while(atomic_load(&bench_stress_received) < total)
+    {
+        uint32_t length ;
+        if(turn++ & 1)
+        {
+            ring_buffer_region region ;
+            ring_buffer_mpmc_ticket ticket ;
+            if(!RBQ_Read_Claim(&bench_mpmc, &region, &ticket))
+            {
+                sched_yield();
+                continue ;
+            }
+            length = Bench_Stress_Copy(message, &region);
+            RBQ_Read_Release(&bench_mpmc, &ticket);
+        }
+        else if(!RBQ_Read_Chapter(&bench_mpmc, message, &length))
+        {
+            sched_yield();
+            continue ;
+        }
+        Bench_Stress_Check(message, length, last);
+        atomic_fetch_add(&bench_stress_received, 1);
+    }
+    return NULL ;
+}
+
+//MPMC 正确性压力测试：检查每条消息的内容、同一生产者的消息在每个消费者处的顺序、
+//以及每个生产者的消息恰好收到一次(序号之和)，有错误时返回1；配合 make tsan 检查数据竞争
+static int Bench_Mpmc_Stress(void)
+{
+    pthread_t producers[BENCH_STRESS_PRODUCERS], consumers[BENCH_STRESS_CONSUMERS];
+    Bench_Stress_Reset(200000 / bench_scale);
+    RBQ_Init(&bench_mpmc, bench_mpmc_slots, BENCH_STRESS_SLOTS, bench_mpmc_buffer, BENCH_STRESS_SLOT_SIZE);
+    uint64_t start = Bench_Now();
+    for(uint32_t i = 0; i < BENCH_STRESS_CONSUMERS; i++)
+        pthread_create(&consumers[i], NULL, Bench_Stress_Consumer, NULL);
+    for(uint32_t i = 0; i < BENCH_STRESS_PRODUCERS; i++)
+        pthread_create(&producers[i], NULL, Bench_Stress_Producer, (void *)(uintptr_t)i);
+    for(uint32_t i = 0; i < BENCH_STRESS_PRODUCERS; i++)
+        pthread_join(producers[i], NULL);
+    for(uint32_t i = 0; i < BENCH_STRESS_CONSUMERS; i++)
+        pthread_join(consumers[i], NULL);
+    uint64_t elapsed = Bench_Now() - start ;
+    uint64_t messages = (uint64_t)bench_stress_messages * BENCH_STRESS_PRODUCERS ;
+    uint64_t errors = Bench_Stress_Errors();
+    if(RBQ_Get_Used_Slots(&bench_mpmc) != 0)
+        errors ++ ;
+    printf("{\"bench\":\"mpmc_stress\",\"producers\":%u,\"consumers\":%u,\"messages\":%llu,\"ns_per_message\":%.1f,\"errors\":%llu}\n",
+           BENCH_STRESS_PRODUCERS, BENCH_STRESS_CONSUMERS, (unsigned long long)messages,
+           (double)elapsed / (double)messages, (unsigned long long)errors);
+    return errors != 0 ;
+}
+
+//分片压力测试：每个生产者固定写入自己的分片，消费者数量少于分片数量，最后一个分片只能被窃取
+#define BENCH_SHARD_SLOTS       32                  //每个分片的槽位数量
+
+static ring_buffer_sharded bench_shard ;
+static ring_buffer_shard bench_shards[BENCH_STRESS_PRODUCERS];
+static ring_buffer_mpmc_slot bench_shard_slots[BENCH_STRESS_PRODUCERS * BENCH_SHARD_SLOTS];
+static uint8_t bench_shard_buffer[BENCH_STRESS_PRODUCERS * BENCH_SHARD_SLOTS * BENCH_STRESS_SLOT_SIZE];
+//保序模式下每个生产者的上一条序号+1，所有消费者共用，只在持有对应分片的处理锁时访问
+static uint32_t bench_shard_order[BENCH_STRESS_PRODUCERS];
+
+//分片压力测试的生产者线程
+static void *Bench_Shard_Producer(void *arg)
+{
+    uint32_t producer = (uint32_t)(uintptr_t)arg ;
+    uint8_t message[BENCH_STRESS_MESSAGE];
+    for(uint32_t sequence = 0; sequence < bench_stress_messages; sequence++)
+    {
+        uint32_t length = Bench_Stress_Fill(message, producer, sequence);
+        while(!RBSD_Write_Chapter(&bench_shard, producer, message, length))
+            sched_yield();
+    }
+    return NULL ;
+}
+
+//分片处理回调：context 为本消费者的顺序记录，保序模式下改用所有消费者共用的记录
+static void Bench_Shard_Callback(void *context, uint32_t shard_Index, ring_buffer_region *region)
+{
+    uint8_t message[BENCH_STRESS_MESSAGE];
+    uint32_t *last = (bench_shard.flags & RING_BUFFER_SHARD_FLAG_ORDERED) ? bench_shard_order : (uint32_t *)context ;
+    uint32_t length = Bench_Stress_Copy(message, region);
+    if(length && message[0] != shard_Index)
+        atomic_fetch_add(&bench_stress_errors, 1);
+    Bench_Stress_Check(message, length, last);
+    atomic_fetch_add(&bench_stress_received, 1);
+}
+
+//分片压力测试的消费者线程，arg 为本地分片编号
+static void *Bench_Shard_Consumer(void *arg)
+{
+    uint32_t home = (uint32_t)(uintptr_t)arg ;
+    uint64_t total = (uint64_t)bench_stress_messages * BENCH_STRESS_PRODUCERS ;
+    uint32_t last[BENCH_STRESS_PRODUCERS] = {0};
+    while(atomic_load(&bench_stress_received) < total)
+        if(!RBSD_Drain(&bench_shard, home, 8, 4, Bench_Shard_Callback, last))
+            sched_yield();
+    return NULL ;
+}
+
+//分片集合正确性压力测试：检查项与 mpmc_stress 相同，保序模式下还检查同一生产者的消息在所有消费者之间的处理顺序，
+//有错误时返回1
+static int Bench_Shard_Stress(uint8_t flags)
+{
+    pthread_t producers[BENCH_STRESS_PRODUCERS], consumers[BENCH_STRESS_CONSUMERS];
+    Bench_Stress_Reset(200000 / bench_scale);
+    memset(bench_shard_order, 0, sizeof(bench_shard_order));
+    RBSD_Init(&bench_shard, bench_shards, BENCH_STRESS_PRODUCERS, bench_shard_slots, BENCH_SHARD_SLOTS,\
+              bench_shard_buffer, BENCH_STRESS_SLOT_SIZE, flags);
+    uint64_t start = Bench_Now();
+    for(uint32_t i = 0; i < BENCH_STRESS_CONSUMERS; i++)
+        pthread_create(&consumers[i], NULL, Bench_Shard_Consumer, (void *)(uintptr_t)i);
+    for(uint32_t i = 0; i < BENCH_STRESS_PRODUCERS; i++)
+        pthread_create(&producers[i], NULL, Bench_Shard_Producer, (void *)(uintptr_t)i);
+    for(uint32_t i = 0; i < BENCH_STRESS_PRODUCERS; i++)
+        pthread_join(producers[i], NULL);
+    for(uint32_t i = 0; i < BENCH_STRESS_CONSUMERS; i++)
+        pthread_join(consumers[i], NULL);
+    uint64_t elapsed = Bench_Now() - start ;
+    uint64_t messages = (uint64_t)bench_stress_messages * BENCH_STRESS_PRODUCERS ;
+    uint64_t errors = Bench_Stress_Errors();
+    if(RBSD_Get_Used_Slots(&bench_shard) != 0)
+        errors ++ ;
+    printf("{\"bench\":\"shard_stress\",\"mode\":\"%s\",\"producers\":%u,\"consumers\":%u,\"messages\":%llu,\"ns_per_message\":%.1f,\"errors\":%llu}\n",
+           (flags & RING_BUFFER_SHARD_FLAG_ORDERED) ? "ordered" : "normal", BENCH_STRESS_PRODUCERS, BENCH_STRESS_CONSUMERS,
+           (unsigned long long)messages, (double)elapsed / (double)messages, (unsigned long long)errors);
+    return errors != 0 ;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *modes[] = {"arbitrary", "pow2"};
+    static const uint32_t sizes[] = {1, 8, 64, 512, 4096, 16384};
+    static const uint32_t chapter_sizes[] = {8, 64, 512, 4096};
+    int failed = 0 ;
+    for(int i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--quick") == 0)
+            bench_scale = 20 ;
+        else if(strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            bench_filter = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [--quick] [--filter prefix]\n", argv[0]);
+            return 1 ;
+        }
+    }
+    for(uint32_t i = 0; i < sizeof(bench_input); i++)
+        bench_input[i] = (uint8_t)i ;
+
+    if(Bench_Enabled("rb_byte"))
+        for(uint32_t m = 0; m < 2; m++)
+            Bench_Byte(modes[m]);
+    if(Bench_Enabled("rb_string"))
+        for(uint32_t m = 0; m < 2; m++)
+            for(uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+                for(int wrap = 0; wrap < 2; wrap++)
+                    if(!wrap || sizes[s] > 1)
+                        Bench_String(modes[m], sizes[s], wrap);
+    if(Bench_Enabled("rbc_cycle"))
+        for(uint32_t s = 0; s < sizeof(chapter_sizes) / sizeof(chapter_sizes[0]); s++)
+            Bench_Chapter(chapter_sizes[s]);
+    if(Bench_Enabled("rbc_delete"))
+        for(uint32_t n = 1; n <= 1024; n *= 8)
+            Bench_Chapter_Delete(8, n);
+    if(Bench_Enabled("spsc"))
+        for(uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+            if(sizes[s] >= 8)
+                Bench_Spsc(sizes[s]);
+#if RING_BUFFER_SPSC_WAIT
+    if(Bench_Enabled("spsc_wait") && Bench_Spsc_Wait())
+        failed = 1 ;
+#endif
+    if(Bench_Enabled("mpmc_stress") && Bench_Mpmc_Stress())
+        failed = 1 ;
+    if(Bench_Enabled("shard_stress"))
+        for(uint8_t flags = 0; flags <= RING_BUFFER_SHARD_FLAG_ORDERED; flags++)
+            if(Bench_Shard_Stress(flags))
+                failed = 1 ;
+    if(Bench_Enabled("rb_large"))
+        Bench_Large_All();
+    return failed ;
+}
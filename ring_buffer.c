@@ -9,6 +9,133 @@
 #include <stdint.h>
 #include <string.h>
 #include "ring_buffer.h"
+#include "ring_buffer_copy.h"
+
+#ifdef RING_BUFFER_STATS
+//计算直方图桶号：0 对应空缓冲区，k 对应 [2^(k-1), 2^k)
+static uint32_t RB_Stats_Bucket(uint32_t Length)
+{
+#if defined(__GNUC__)
+    return Length ? 32 - (uint32_t)__builtin_clz(Length) : 0 ;
+#else
+    uint32_t bucket = 0 ;
+    while(Length)
+    {
+        bucket ++ ;
+        Length >>= 1 ;
+    }
+    return bucket ;
+#endif
+}
+
+//将头尾指针换算为数组下标
+static uint32_t RB_Stats_Index(ring_buffer *rb_handle, uint32_t position)
+{
+    return rb_handle->mask ? (position & rb_handle->mask) : position ;
+}
+
+//在写入前记录统计，空间不足时只记录拒绝次数
+static void RB_Stats_Write(ring_buffer *rb_handle, uint32_t Length)
+{
+    ring_buffer_stats *stats = rb_handle->stats ;
+    uint32_t stored = RB_Get_Length(rb_handle);
+    if(Length > rb_handle->max_Length - stored)
+    {
+        stats->write_rejected ++ ;
+        return ;
+    }
+    if(Length > rb_handle->max_Length - RB_Stats_Index(rb_handle, rb_handle->tail) && !(rb_handle->flags & RING_BUFFER_FLAG_MIRROR))
+        stats->wrap_split ++ ;
+    stored += Length ;
+    stats->bytes_in += Length ;
+    if(stored > stats->high_water)
+        stats->high_water = stored ;
+    stats->occupancy_histogram[RB_Stats_Bucket(stored)] ++ ;
+}
+
+//在读出或删除前记录统计，copy 为0时表示删除，不涉及拷贝
+static void RB_Stats_Read(ring_buffer *rb_handle, uint32_t Length, uint8_t copy)
+{
+    ring_buffer_stats *stats = rb_handle->stats ;
+    if(Length > RB_Get_Length(rb_handle))
+        return ;
+    if(copy && Length > rb_handle->max_Length - RB_Stats_Index(rb_handle, rb_handle->head) && !(rb_handle->flags & RING_BUFFER_FLAG_MIRROR))
+        stats->wrap_split ++ ;
+    stats->bytes_out += Length ;
+}
+
+//未挂接统计数据时只多一次指针判断
+#define RB_STATS_WRITE(rb_handle, Length)           do{ if((rb_handle)->stats) RB_Stats_Write(rb_handle, Length); }while(0)
+#define RB_STATS_READ(rb_handle, Length, copy)      do{ if((rb_handle)->stats) RB_Stats_Read(rb_handle, Length, copy); }while(0)
+#else
+//未定义 RING_BUFFER_STATS 时统计钩子为空语句，读写函数不访问 stats 指针(仅为固定布局保留，初始化时置为NULL)
+#define RB_STATS_WRITE(rb_handle, Length)           ((void)0)
+#define RB_STATS_READ(rb_handle, Length, copy)      ((void)0)
+#endif
+
+/*
+ * 2的幂模式的快速路径
+ * head、tail 自由递增并在 uint32_t 范围内自然溢出，数组空间整除 2^32，
+ * 因此 tail - head 始终等于已储存的数据量，下标由掩码得到，无需回绕判断
+*/
+
+static uint8_t RB_Pow2_Delete(ring_buffer *rb_handle, uint32_t Length)
+{
+    if((rb_handle->tail - rb_handle->head) < Length)
+        return RING_BUFFER_ERROR ;
+    rb_handle->head += Length ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+static uint8_t RB_Pow2_Write_Byte(ring_buffer *rb_handle, uint8_t data)
+{
+    if((rb_handle->tail - rb_handle->head) == rb_handle->max_Length)
+        return RING_BUFFER_ERROR ;
+    *(rb_handle->array_addr + (rb_handle->tail & rb_handle->mask)) = data ;
+    rb_handle->tail ++ ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+static uint8_t RB_Pow2_Read_Byte(ring_buffer *rb_handle, uint8_t *output_addr)
+{
+    if(rb_handle->tail == rb_handle->head)
+        return RING_BUFFER_ERROR ;
+    *output_addr = *(rb_handle->array_addr + (rb_handle->head & rb_handle->mask));
+    rb_handle->head ++ ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+static uint8_t RB_Pow2_Write_String(ring_buffer *rb_handle, uint8_t *input_addr, uint32_t write_Length)
+{
+    if((rb_handle->max_Length - (rb_handle->tail - rb_handle->head)) < write_Length)
+        return RING_BUFFER_ERROR ;
+    uint32_t index = rb_handle->tail & rb_handle->mask ;
+    uint32_t write_size_a = rb_handle->max_Length - index ;
+    if(write_size_a < write_Length && !(rb_handle->flags & RING_BUFFER_FLAG_MIRROR))
+    {
+        RB_COPY_IN(rb_handle->array_addr + index, input_addr, write_size_a);
+        RB_COPY_IN(rb_handle->array_addr, input_addr + write_size_a, write_Length - write_size_a);
+    }
+    else RB_COPY_IN(rb_handle->array_addr + index, input_addr, write_Length);
+    rb_handle->tail += write_Length ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+static uint8_t RB_Pow2_Read_String(ring_buffer *rb_handle, uint8_t *output_addr, uint32_t read_Length)
+{
+    if((rb_handle->tail - rb_handle->head) < read_Length)
+        return RING_BUFFER_ERROR ;
+    uint32_t index = rb_handle->head & rb_handle->mask ;
+    uint32_t Read_size_a = rb_handle->max_Length - index ;
+    if(Read_size_a < read_Length && !(rb_handle->flags & RING_BUFFER_FLAG_MIRROR))
+    {
+        memcpy(output_addr, rb_handle->array_addr + index, Read_size_a);
+        memcpy(output_addr + Read_size_a, rb_handle->array_addr, read_Length - Read_size_a);
+    }
+    else memcpy(output_addr, rb_handle->array_addr + index, read_Length);
+    rb_handle->head += read_Length ;
+    return RING_BUFFER_SUCCESS ;
+}
 
 /**
  * \brief 初始化新缓冲区
@@ -29,9 +156,54 @@ uint8_t RB_Init(ring_buffer *rb_handle, uint8_t *buffer_addr ,uint32_t buffer_si
     rb_handle->Length = 0 ; //复位已存储数据长度
     rb_handle->array_addr = buffer_addr ; //缓冲区储存数组基地址
     rb_handle->max_Length = buffer_size ; //缓冲区最大可储存数据量
+    rb_handle->mask = 0 ; //任意长度模式
+    rb_handle->flags = 0 ;
+    rb_handle->stats = NULL ; //不挂接运行统计
     return RING_BUFFER_SUCCESS ; //缓冲区初始化成功
 }
 
+/**
+ * \brief 初始化长度为2的幂的快速缓冲区，之后的读写接口与 RB_Init 初始化的缓冲区完全相同
+ * \param[out] rb_handle: 待初始化的缓冲区结构体句柄
+ * \param[in] buffer_addr: 外部定义的缓冲区数组，类型必须为 uint8_t
+ * \param[in] buffer_size: 外部定义的缓冲区数组空间，必须为2的幂
+ * \return 返回缓冲区初始化的结果
+ *      \arg RING_BUFFER_SUCCESS: 初始化成功
+ *      \arg RING_BUFFER_ERROR: 初始化失败
+*/
+uint8_t RB_Init_Pow2(ring_buffer *rb_handle, uint8_t *buffer_addr ,uint32_t buffer_size)
+{
+    //缓冲区数组空间必须为2的幂，且在 2 ~ 0x80000000 之间
+    if(buffer_size < 2 || (buffer_size & (buffer_size - 1)))
+        return RING_BUFFER_ERROR ;
+    rb_handle->head = 0 ;
+    rb_handle->tail = 0 ;
+    rb_handle->Length = 0 ;
+    rb_handle->array_addr = buffer_addr ;
+    rb_handle->max_Length = buffer_size ;
+    rb_handle->mask = buffer_size - 1 ;
+    rb_handle->flags = 0 ;
+    rb_handle->stats = NULL ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 开启或关闭覆盖模式，开启后缓冲区空间不足时从头指针丢弃最旧的数据，RB_Write_Byte 与 RB_Write_String 总是成功
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] enable: 1 开启，0 关闭
+ * \return 返回设置结果
+ *      \arg RING_BUFFER_SUCCESS: 设置成功
+ * \note 预留/提交接口不受覆盖模式影响，仍然只能使用可用空间
+*/
+uint8_t RB_Set_Overwrite(ring_buffer *rb_handle, uint8_t enable)
+{
+    if(enable)
+        rb_handle->flags |= RING_BUFFER_FLAG_OVERWRITE ;
+    else
+        rb_handle->flags &= (uint8_t)~RING_BUFFER_FLAG_OVERWRITE ;
+    return RING_BUFFER_SUCCESS ;
+}
+
 /**
  * \brief 从头指针开始删除指定长度的数据
  * \param[out] rb_handle: 缓冲区结构体句柄
@@ -42,6 +214,9 @@ uint8_t RB_Init(ring_buffer *rb_handle, uint8_t *buffer_addr ,uint32_t buffer_si
 */
 uint8_t RB_Delete(ring_buffer *rb_handle, uint32_t Length)
 {
+    RB_STATS_READ(rb_handle, Length, 0);
+    if(rb_handle->mask)
+        return RB_Pow2_Delete(rb_handle, Length) ;//2的幂模式
     if(rb_handle->Length < Length)
         return RING_BUFFER_ERROR ;//已储存的数据量小于需删除的数据量
     else
@@ -65,6 +240,12 @@ uint8_t RB_Delete(ring_buffer *rb_handle, uint32_t Length)
 */
 uint8_t RB_Write_Byte(ring_buffer *rb_handle, uint8_t data)
 {
+    //覆盖模式下缓冲区已满时丢弃最旧的一个字节
+    if((rb_handle->flags & RING_BUFFER_FLAG_OVERWRITE) && !RB_Get_FreeSize(rb_handle))
+        RB_Delete(rb_handle, 1);
+    RB_STATS_WRITE(rb_handle, 1);
+    if(rb_handle->mask)
+        return RB_Pow2_Write_Byte(rb_handle, data) ;//2的幂模式
     //缓冲区数组已满，产生覆盖错误
     if(rb_handle->Length == (rb_handle->max_Length))
         return RING_BUFFER_ERROR ;
@@ -90,6 +271,9 @@ uint8_t RB_Write_Byte(ring_buffer *rb_handle, uint8_t data)
 */
 uint8_t RB_Read_Byte(ring_buffer *rb_handle, uint8_t *output_addr)
 {
+    RB_STATS_READ(rb_handle, 1, 1);
+    if(rb_handle->mask)
+        return RB_Pow2_Read_Byte(rb_handle, output_addr) ;//2的幂模式
     if (rb_handle->Length != 0)//有数据未读出
     {
         *output_addr = *(rb_handle->array_addr + rb_handle->head);//读取数据
@@ -114,6 +298,21 @@ uint8_t RB_Read_Byte(ring_buffer *rb_handle, uint8_t *output_addr)
 */
 uint8_t RB_Write_String(ring_buffer *rb_handle, uint8_t *input_addr, uint32_t write_Length)
 {
+    if(rb_handle->flags & RING_BUFFER_FLAG_OVERWRITE)
+    {
+        //覆盖模式下超出数组空间的数据只保留最后 max_Length 字节，空间不足时丢弃最旧的数据
+        if(write_Length > rb_handle->max_Length)
+        {
+            input_addr += write_Length - rb_handle->max_Length ;
+            write_Length = rb_handle->max_Length ;
+        }
+        uint32_t free_size = RB_Get_FreeSize(rb_handle);
+        if(free_size < write_Length)
+            RB_Delete(rb_handle, write_Length - free_size);
+    }
+    RB_STATS_WRITE(rb_handle, write_Length);
+    if(rb_handle->mask)
+        return RB_Pow2_Write_String(rb_handle, input_addr, write_Length) ;//2的幂模式
     //如果不够存储空间存放新数据,返回错误
     if((rb_handle->Length + write_Length) > (rb_handle->max_Length))
         return RING_BUFFER_ERROR ;
@@ -121,25 +320,25 @@ uint8_t RB_Write_String(ring_buffer *rb_handle, uint8_t *input_addr, uint32_t wr
     {
         //设置两次写入长度
         uint32_t write_size_a, write_size_b ;
-        //如果顺序可用长度小于需写入的长度，需要将数据拆成两次分别写入
-        if((rb_handle->max_Length - rb_handle->tail) < write_Length)
+        //如果顺序可用长度小于需写入的长度，需要将数据拆成两次分别写入(镜像模式下总是连续的)
+        if((rb_handle->max_Length - rb_handle->tail) < write_Length && !(rb_handle->flags & RING_BUFFER_FLAG_MIRROR))
         {
             write_size_a = rb_handle->max_Length - rb_handle->tail ;//从尾指针开始写到储存数组末尾
             write_size_b = write_Length - write_size_a ;//从储存数组开头写数据
             //分别拷贝a、b段数据到储存数组中
-            memcpy(rb_handle->array_addr + rb_handle->tail, input_addr, write_size_a);
-            memcpy(rb_handle->array_addr, input_addr + write_size_a, write_size_b);
+            RB_COPY_IN(rb_handle->array_addr + rb_handle->tail, input_addr, write_size_a);
+            RB_COPY_IN(rb_handle->array_addr, input_addr + write_size_a, write_size_b);
             rb_handle->Length += write_Length ;//记录新存储了多少数据量
             rb_handle->tail = write_size_b ;//重新定位尾指针位置
         }
         else//如果顺序可用长度大于或等于需写入的长度，则只需要写入一次
         {
             write_size_a = write_Length ;//从尾指针开始写到储存数组末尾
-            memcpy(rb_handle->array_addr + rb_handle->tail, input_addr, write_size_a);
+            RB_COPY_IN(rb_handle->array_addr + rb_handle->tail, input_addr, write_size_a);
             rb_handle->Length += write_Length ;//记录新存储了多少数据量
             rb_handle->tail += write_size_a ;//重新定位尾指针位置
-            if(rb_handle->tail == rb_handle->max_Length)
-                rb_handle->tail = 0 ;//如果写入数据后尾指针刚好写到数组尾部，则回到开头，防止越位
+            if(rb_handle->tail >= rb_handle->max_Length)
+                rb_handle->tail -= rb_handle->max_Length ;//如果写入数据后尾指针到达或越过数组尾部(镜像模式)，则回到开头，防止越位
         }
         return RING_BUFFER_SUCCESS ;
     }
@@ -156,12 +355,15 @@ uint8_t RB_Write_String(ring_buffer *rb_handle, uint8_t *input_addr, uint32_t wr
 */
 uint8_t RB_Read_String(ring_buffer *rb_handle, uint8_t *output_addr, uint32_t read_Length)
 {
+    RB_STATS_READ(rb_handle, read_Length, 1);
+    if(rb_handle->mask)
+        return RB_Pow2_Read_String(rb_handle, output_addr, read_Length) ;//2的幂模式
     if(read_Length > rb_handle->Length)
         return RING_BUFFER_ERROR ;
     else
     {
         uint32_t Read_size_a, Read_size_b ;
-        if(read_Length > (rb_handle->max_Length - rb_handle->head))
+        if(read_Length > (rb_handle->max_Length - rb_handle->head) && !(rb_handle->flags & RING_BUFFER_FLAG_MIRROR))
         {
             Read_size_a = rb_handle->max_Length - rb_handle->head ;
             Read_size_b = read_Length - Read_size_a ;
@@ -176,13 +378,156 @@ uint8_t RB_Read_String(ring_buffer *rb_handle, uint8_t *output_addr, uint32_t re
             memcpy(output_addr, rb_handle->array_addr + rb_handle->head, Read_size_a);
             rb_handle->Length -= read_Length ;//记录剩余数据量
             rb_handle->head += Read_size_a ;//重新定位头指针位置
-            if(rb_handle->head == rb_handle->max_Length)
-                rb_handle->head = 0 ;//如果读取数据后头指针刚好写到数组尾部，则回到开头，防止越位
+            if(rb_handle->head >= rb_handle->max_Length)
+                rb_handle->head -= rb_handle->max_Length ;//如果读取数据后头指针到达或越过数组尾部(镜像模式)，则回到开头，防止越位
         }
         return RING_BUFFER_SUCCESS ;
     }
 }
 
+//将数组下标 index 开始、长度为 Length 的区域按数组末尾拆分为两段，镜像模式下不拆分
+static void RB_Make_Region(ring_buffer *rb_handle, uint32_t index, uint32_t Length, ring_buffer_region *region)
+{
+    if(Length > (rb_handle->max_Length - index) && !(rb_handle->flags & RING_BUFFER_FLAG_MIRROR))
+    {
+        region->addr_a = rb_handle->array_addr + index ;
+        region->Length_a = rb_handle->max_Length - index ;
+        region->addr_b = rb_handle->array_addr ;
+        region->Length_b = Length - region->Length_a ;
+    }
+    else
+    {
+        region->addr_a = rb_handle->array_addr + index ;
+        region->Length_a = Length ;
+        region->addr_b = NULL ;
+        region->Length_b = 0 ;
+    }
+}
+
+/**
+ * \brief 预留尾指针之后指定长度的可写区域，供调用者直接写入数据
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \param[in] reserve_Length: 需要预留的字节数
+ * \param[out] region: 预留区域的描述，跨越数组末尾时分为a、b两段
+ * \return 返回预留结果
+ *      \arg RING_BUFFER_SUCCESS: 预留成功
+ *      \arg RING_BUFFER_ERROR: 预留失败，可用空间不足
+ * \note 预留不改变缓冲区状态，写入完成后需调用 RB_Write_Commit 提交
+*/
+uint8_t RB_Write_Reserve(ring_buffer *rb_handle, uint32_t reserve_Length, ring_buffer_region *region)
+{
+    if(reserve_Length > RB_Get_FreeSize(rb_handle))
+        return RING_BUFFER_ERROR ;
+    RB_Make_Region(rb_handle, rb_handle->mask ? (rb_handle->tail & rb_handle->mask) : rb_handle->tail, reserve_Length, region);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 提交已直接写入预留区域的数据，尾指针向前推进
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] commit_Length: 实际写入的字节数，可小于预留长度
+ * \return 返回提交结果
+ *      \arg RING_BUFFER_SUCCESS: 提交成功
+ *      \arg RING_BUFFER_ERROR: 提交失败，超出可用空间
+*/
+uint8_t RB_Write_Commit(ring_buffer *rb_handle, uint32_t commit_Length)
+{
+    RB_STATS_WRITE(rb_handle, commit_Length);
+    if(commit_Length > RB_Get_FreeSize(rb_handle))
+        return RING_BUFFER_ERROR ;
+    if(rb_handle->mask)
+    {
+        rb_handle->tail += commit_Length ;//2的幂模式
+        return RING_BUFFER_SUCCESS ;
+    }
+    if(commit_Length >= (rb_handle->max_Length - rb_handle->tail))
+        rb_handle->tail = commit_Length - (rb_handle->max_Length - rb_handle->tail);
+    else
+        rb_handle->tail += commit_Length ;
+    rb_handle->Length += commit_Length ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 获取头指针之后指定长度数据所在的区域，供调用者直接读取数据
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \param[in] peek_Length: 需要读取的字节数
+ * \param[out] region: 数据区域的描述，跨越数组末尾时分为a、b两段
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_SUCCESS: 获取成功
+ *      \arg RING_BUFFER_ERROR: 获取失败，已储存的数据量不足
+ * \note 获取不改变缓冲区状态，处理完成后需调用 RB_Read_Consume 释放
+*/
+uint8_t RB_Read_Peek(ring_buffer *rb_handle, uint32_t peek_Length, ring_buffer_region *region)
+{
+    if(peek_Length > RB_Get_Length(rb_handle))
+        return RING_BUFFER_ERROR ;
+    RB_Make_Region(rb_handle, rb_handle->mask ? (rb_handle->head & rb_handle->mask) : rb_handle->head, peek_Length, region);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 释放已直接处理完毕的数据，头指针向前推进
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] consume_Length: 需要释放的字节数
+ * \return 返回释放结果
+ *      \arg RING_BUFFER_SUCCESS: 释放成功
+ *      \arg RING_BUFFER_ERROR: 释放失败，已储存的数据量不足
+*/
+uint8_t RB_Read_Consume(ring_buffer *rb_handle, uint32_t consume_Length)
+{
+    return RB_Delete(rb_handle, consume_Length);
+}
+
+#ifdef RING_BUFFER_STATS
+/**
+ * \brief 挂接运行统计数据并清零(需定义 RING_BUFFER_STATS 编译)
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] stats: 外部定义的统计数据，生命周期须覆盖缓冲区的使用期，传入NULL时停止统计
+ * \return 返回挂接结果
+ *      \arg RING_BUFFER_SUCCESS: 挂接成功
+ * \note 统计数据不占用句柄空间，未挂接的缓冲区读写时只多一次指针判断
+*/
+uint8_t RB_Set_Stats(ring_buffer *rb_handle, ring_buffer_stats *stats)
+{
+    if(stats != NULL)
+        memset(stats, 0, sizeof(ring_buffer_stats));
+    rb_handle->stats = stats ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 获取运行统计(需定义 RING_BUFFER_STATS 编译)
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \param[out] output_stats: 统计数据保存地址
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_SUCCESS: 获取成功
+ *      \arg RING_BUFFER_ERROR: 获取失败，未挂接统计数据
+*/
+uint8_t RB_Get_Stats(ring_buffer *rb_handle, ring_buffer_stats *output_stats)
+{
+    if(rb_handle->stats == NULL)
+        return RING_BUFFER_ERROR ;
+    *output_stats = *(rb_handle->stats) ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 清零运行统计(需定义 RING_BUFFER_STATS 编译)
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \return 返回清零结果
+ *      \arg RING_BUFFER_SUCCESS: 清零成功
+ *      \arg RING_BUFFER_ERROR: 清零失败，未挂接统计数据
+*/
+uint8_t RB_Reset_Stats(ring_buffer *rb_handle)
+{
+    if(rb_handle->stats == NULL)
+        return RING_BUFFER_ERROR ;
+    memset(rb_handle->stats, 0, sizeof(ring_buffer_stats));
+    return RING_BUFFER_SUCCESS ;
+}
+#endif
+
 /**
  * \brief 获取缓冲区里已储存的数据长度
  * \param[in] rb_handle: 缓冲区结构体句柄
@@ -190,6 +535,8 @@ uint8_t RB_Read_String(ring_buffer *rb_handle, uint8_t *output_addr, uint32_t re
 */
 uint32_t RB_Get_Length(ring_buffer *rb_handle)
 {
+    if(rb_handle->mask)
+        return rb_handle->tail - rb_handle->head ;//2的幂模式
     return rb_handle->Length ;
 }
 
@@ -200,6 +547,8 @@ uint32_t RB_Get_Length(ring_buffer *rb_handle)
 */
 uint32_t RB_Get_FreeSize(ring_buffer *rb_handle)
 {
+    if(rb_handle->mask)
+        return rb_handle->max_Length - (rb_handle->tail - rb_handle->head) ;//2的幂模式
     return (rb_handle->max_Length - rb_handle->Length) ;
 }
 
@@ -8,11 +8,36 @@
 #ifndef _RING_BUFFER_H_
 #define _RING_BUFFER_H_
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 //返回值定义
 #define RING_BUFFER_SUCCESS     0x01
 #define RING_BUFFER_ERROR       0x00
 
+//工作模式标志位定义
+#define RING_BUFFER_FLAG_MIRROR     0x01    //数组后紧跟同一物理内存的镜像映射，任意不超过数组空间的区域均连续
+#define RING_BUFFER_FLAG_OVERWRITE  0x02    //覆盖模式，空间不足时丢弃最旧的数据，写入总是成功
+
+//运行统计，仅在定义 RING_BUFFER_STATS 编译时启用，未定义时统计类型、接口与代码全部不参与编译
+//统计数据由调用者定义并通过 RB_Set_Stats 挂接，句柄中只保留一个指针，结构体布局与是否定义该宏无关
+struct ring_buffer_stats ;
+#ifdef RING_BUFFER_STATS
+#define RING_BUFFER_STATS_HISTOGRAM     33  //占用量直方图桶数，第k桶(k>0)统计占用量在 [2^(k-1), 2^k) 的次数，第0桶统计空缓冲区
+typedef struct ring_buffer_stats
+{
+    uint64_t bytes_in ;                                             //写入的字节总数
+    uint64_t bytes_out ;                                            //读出与删除的字节总数
+    uint64_t write_rejected ;                                       //空间不足被拒绝的写入次数
+    uint64_t wrap_split ;                                           //跨越数组末尾被拆成两次拷贝的读写次数
+    uint32_t high_water ;                                           //已储存数据量的历史最大值
+    uint64_t occupancy_histogram[RING_BUFFER_STATS_HISTOGRAM] ;     //每次写入后已储存数据量的 log2 直方图
+}ring_buffer_stats;
+#endif
+
 //环形缓冲区结构体
+//2的幂模式下 head、tail 为自由递增的计数值，与 mask 相与得到数组下标，Length 不再使用
 typedef struct
 {
     uint32_t head ;             //操作头指针
@@ -20,15 +45,42 @@ typedef struct
     uint32_t Length ;           //已储存的数据量
     uint8_t *array_addr ;       //缓冲区储存数组基地址
     uint32_t max_Length ;       //缓冲区最大可储存数据量
+    uint32_t mask ;             //2的幂模式下标掩码(max_Length - 1)，为0时表示任意长度模式
+    uint8_t flags ;             //工作模式标志位
+    struct ring_buffer_stats *stats ;   //运行统计，初始化后为NULL，由 RB_Set_Stats 挂接
 }ring_buffer;
 
+//缓冲区内连续区域描述，跨越数组末尾时被拆分为a、b两段
+typedef struct
+{
+    uint8_t *addr_a ;           //第一段起始地址
+    uint32_t Length_a ;         //第一段长度
+    uint8_t *addr_b ;           //第二段起始地址(数组开头)，不跨越末尾或镜像模式时为NULL
+    uint32_t Length_b ;         //第二段长度
+}ring_buffer_region;
+
 uint8_t RB_Init(ring_buffer *rb_handle, uint8_t *buffer_addr ,uint32_t buffer_size);               //初始化基础环形缓冲区
+uint8_t RB_Init_Pow2(ring_buffer *rb_handle, uint8_t *buffer_addr ,uint32_t buffer_size);          //初始化长度为2的幂的快速环形缓冲区
+uint8_t RB_Set_Overwrite(ring_buffer *rb_handle, uint8_t enable);                                  //开启或关闭覆盖模式
 uint8_t RB_Delete(ring_buffer *rb_handle, uint32_t Length);                                        //从头指针开始删除指定长度的数据
 uint8_t RB_Write_Byte(ring_buffer *rb_handle, uint8_t data);                                       //向缓冲区尾指针写一个字节
 uint8_t RB_Write_String(ring_buffer *rb_handle, uint8_t *input_addr, uint32_t write_Length);       //向缓冲区尾指针写指定长度数据
 uint8_t RB_Read_Byte(ring_buffer *rb_handle, uint8_t *output_addr);                                //从缓冲区头指针读一个字节
 uint8_t RB_Read_String(ring_buffer *rb_handle, uint8_t *output_addr, uint32_t read_Length);        //从缓冲区头指针读指定长度数据
+uint8_t RB_Write_Reserve(ring_buffer *rb_handle, uint32_t reserve_Length, ring_buffer_region *region);  //预留尾指针后指定长度的可写区域
+uint8_t RB_Write_Commit(ring_buffer *rb_handle, uint32_t commit_Length);                           //提交已直接写入预留区域的数据
+uint8_t RB_Read_Peek(ring_buffer *rb_handle, uint32_t peek_Length, ring_buffer_region *region);    //获取头指针后指定长度数据所在区域
+uint8_t RB_Read_Consume(ring_buffer *rb_handle, uint32_t consume_Length);                          //释放已直接处理完毕的数据
+#ifdef RING_BUFFER_STATS
+uint8_t RB_Set_Stats(ring_buffer *rb_handle, ring_buffer_stats *stats);                            //挂接并清零运行统计，传入NULL时停止统计
+uint8_t RB_Get_Stats(ring_buffer *rb_handle, ring_buffer_stats *output_stats);                     //获取运行统计
+uint8_t RB_Reset_Stats(ring_buffer *rb_handle);                                                    //清零运行统计
+#endif
 uint32_t RB_Get_Length(ring_buffer *rb_handle);                                                    //获取缓冲区里已储存的数据长度
 uint32_t RB_Get_FreeSize(ring_buffer *rb_handle);                                                  //获取缓冲区可用储存空间
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif//#ifndef _RING_BUFFER_H_
\ No newline at end of file
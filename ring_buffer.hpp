@@ -0,0 +1,259 @@
+/**
+ * \file ring_buffer.hpp
+ * \brief 编译期定长的 C++ 环形缓冲模板(仅头文件)，语义与 ring_buffer 一致
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+ *
+ * RingBuffer<T, N>: 按元素类型储存，容量 N 为编译期常量，N 为2的幂时下标回绕编译为掩码运算；
+ *                   支持原地构造、仅可移动的元素类型，平凡可复制类型的批量读写使用 memcpy
+ * ByteRingBuffer<N>: 字节模式，内部直接持有 C 结构体 ring_buffer，可通过 c_handle() 交给 C 接口使用，
+ *                    需要与 ring_buffer.c 一起编译
+ * 需要 C++17
+*/
+
+#ifndef _RING_BUFFER_HPP_
+#define _RING_BUFFER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "ring_buffer.h"
+
+namespace ring_buffer_cpp
+{
+
+template <typename T, std::size_t N>
+class RingBuffer
+{
+    static_assert(N >= 1, "RingBuffer capacity must be at least 1");
+    static constexpr bool is_pow2 = (N & (N - 1)) == 0 ;
+
+public:
+    using value_type = T ;
+
+    RingBuffer() noexcept = default ;
+    ~RingBuffer() { clear(); }
+    RingBuffer(const RingBuffer &) = delete ;
+    RingBuffer &operator=(const RingBuffer &) = delete ;
+
+    //容量与状态
+    static constexpr std::size_t capacity() noexcept { return N ; }
+    std::size_t size() const noexcept { return length_ ; }
+    std::size_t free_size() const noexcept { return N - length_ ; }
+    bool empty() const noexcept { return length_ == 0 ; }
+    bool full() const noexcept { return length_ == N ; }
+
+    //在尾部原地构造一个元素，缓冲区已满时返回 false
+    template <typename... Args>
+    bool emplace(Args &&...args) noexcept(std::is_nothrow_constructible<T, Args...>::value)
+    {
+        if(full())
+            return false ;
+        ::new (static_cast<void *>(slot(tail_))) T(std::forward<Args>(args)...);
+        tail_ = wrap(tail_ + 1);
+        length_ ++ ;
+        return true ;
+    }
+
+    bool push(const T &value) { return emplace(value); }
+    bool push(T &&value) { return emplace(std::move(value)); }
+
+    //从头部取出一个元素(移动到 output)，缓冲区为空时返回 false
+    bool pop(T &output) noexcept(std::is_nothrow_move_assignable<T>::value)
+    {
+        if(empty())
+            return false ;
+        T *item = slot(head_);
+        output = std::move(*item);
+        item->~T();
+        head_ = wrap(head_ + 1);
+        length_ -- ;
+        return true ;
+    }
+
+    //访问头部元素，缓冲区为空时返回 nullptr
+    T *front() noexcept { return empty() ? nullptr : slot(head_); }
+    const T *front() const noexcept { return empty() ? nullptr : slot(head_); }
+
+    //从头部删除指定数量的元素，已储存的数量不足时返回 false
+    bool discard(std::size_t count) noexcept
+    {
+        if(count > length_)
+            return false ;
+        if(!std::is_trivially_destructible<T>::value)
+            for(std::size_t i = 0; i < count; i++)
+                slot(wrap(head_ + i))->~T();
+        head_ = wrap(head_ + count);
+        length_ -= count ;
+        return true ;
+    }
+
+    void clear() noexcept { discard(length_); }
+
+    //批量写入 count 个元素，空间不足时不写入并返回 false(与 RB_Write_String 相同)；
+    //元素拷贝构造抛出异常时析构本次已写入的元素并恢复尾指针，缓冲区保持不变后重新抛出
+    bool write(const T *input, std::size_t count)
+    {
+        if(count > free_size())
+            return false ;
+        if constexpr(std::is_trivially_copyable<T>::value)
+        {
+            //平凡可复制类型最多拆成两次 memcpy
+            std::size_t size_a = N - tail_ ;
+            if(size_a >= count)
+                std::memcpy(slot(tail_), input, count * sizeof(T));
+            else
+            {
+                std::memcpy(slot(tail_), input, size_a * sizeof(T));
+                std::memcpy(slot(0), input + size_a, (count - size_a) * sizeof(T));
+            }
+            tail_ = wrap(tail_ + count);
+            length_ += count ;
+        }
+        else
+        {
+            write_guard guard{this, 0};
+            for(; guard.count < count; guard.count++)
+                emplace(input[guard.count]);
+            guard.count = 0 ;
+        }
+        return true ;
+    }
+
+    //批量读出 count 个元素，已储存的数量不足时不读取并返回 false(与 RB_Read_String 相同)；
+    //全部赋值到 output 之后才释放元素，移动赋值可能抛出异常时改用拷贝赋值，抛出异常时缓冲区保持不变
+    bool read(T *output, std::size_t count)
+    {
+        if(count > length_)
+            return false ;
+        if constexpr(std::is_trivially_copyable<T>::value)
+        {
+            std::size_t size_a = N - head_ ;
+            if(size_a >= count)
+                std::memcpy(output, slot(head_), count * sizeof(T));
+            else
+            {
+                std::memcpy(output, slot(head_), size_a * sizeof(T));
+                std::memcpy(output + size_a, slot(0), (count - size_a) * sizeof(T));
+            }
+            head_ = wrap(head_ + count);
+            length_ -= count ;
+        }
+        else
+        {
+            for(std::size_t i = 0; i < count; i++)
+                output[i] = std::move_if_noexcept(*slot(wrap(head_ + i)));
+            discard(count);
+        }
+        return true ;
+    }
+
+private:
+    //批量写入的回滚：析构时撤销最近写入的 count 个元素，写入完成后将 count 清零
+    struct write_guard
+    {
+        RingBuffer *self ;
+        std::size_t count ;
+        ~write_guard() { self->drop_back(count); }
+    };
+
+    //从尾部撤销 count 个元素
+    void drop_back(std::size_t count) noexcept
+    {
+        for(std::size_t i = 0; i < count; i++)
+        {
+            tail_ = wrap(tail_ + N - 1);
+            slot(tail_)->~T();
+        }
+        length_ -= count ;
+    }
+
+    //下标回绕，参数不超过 2N-1；容量为2的幂时编译为掩码运算
+    static constexpr std::size_t wrap(std::size_t index) noexcept
+    {
+        if constexpr(is_pow2)
+            return index & (N - 1);
+        else
+            return index >= N ? index - N : index ;
+    }
+
+    T *slot(std::size_t index) noexcept { return std::launder(reinterpret_cast<T *>(storage_) + index); }
+    const T *slot(std::size_t index) const noexcept { return std::launder(reinterpret_cast<const T *>(storage_) + index); }
+
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+    std::size_t head_ = 0 ;         //操作头指针
+    std::size_t tail_ = 0 ;         //操作尾指针
+    std::size_t length_ = 0 ;       //已储存的元素数量
+};
+
+namespace detail
+{
+//ring_buffer 与编译宏无关的固定布局，字段与 ring_buffer.h 逐一对应
+//ByteRingBuffer 按值持有 C 结构体，由 ring_buffer.c 初始化与读写，两侧布局不一致会越界访问，
+//因此不信任当前编译配置下的 sizeof(ring_buffer)，而是与这份布局在编译期比对
+struct ring_buffer_layout
+{
+    uint32_t head ;
+    uint32_t tail ;
+    uint32_t Length ;
+    uint8_t *array_addr ;
+    uint32_t max_Length ;
+    uint32_t mask ;
+    uint8_t flags ;
+    void *stats ;
+};
+}//namespace detail
+
+static_assert(std::is_standard_layout<ring_buffer>::value, "ring_buffer must stay a plain C struct");
+static_assert(sizeof(ring_buffer) == sizeof(detail::ring_buffer_layout)
+              && alignof(ring_buffer) == alignof(detail::ring_buffer_layout)
+              && offsetof(ring_buffer, flags) == offsetof(detail::ring_buffer_layout, flags)
+              && offsetof(ring_buffer, stats) == offsetof(detail::ring_buffer_layout, stats),
+              "ring_buffer layout depends on a build option, ByteRingBuffer would disagree with ring_buffer.c");
+
+//字节模式：内部就是 C 的 ring_buffer 结构体，读写调用 C 接口，容量为2的幂时使用 RB_Init_Pow2
+template <std::size_t N>
+class ByteRingBuffer
+{
+    static_assert(N >= 2 && N < 0xFFFFFFFFu, "ByteRingBuffer capacity must fit ring_buffer");
+
+public:
+    ByteRingBuffer() noexcept
+    {
+        if constexpr((N & (N - 1)) == 0)
+            RB_Init_Pow2(&handle_, storage_, static_cast<uint32_t>(N));
+        else
+            RB_Init(&handle_, storage_, static_cast<uint32_t>(N));
+    }
+    ByteRingBuffer(const ByteRingBuffer &) = delete ;
+    ByteRingBuffer &operator=(const ByteRingBuffer &) = delete ;
+
+    static constexpr std::size_t capacity() noexcept { return N ; }
+    //C 接口的查询函数不修改句柄，只是参数没有声明为 const
+    uint32_t size() const noexcept { return RB_Get_Length(const_cast<ring_buffer *>(&handle_)); }
+    uint32_t free_size() const noexcept { return RB_Get_FreeSize(const_cast<ring_buffer *>(&handle_)); }
+
+    bool push(uint8_t data) noexcept { return RB_Write_Byte(&handle_, data) == RING_BUFFER_SUCCESS ; }
+    bool pop(uint8_t &output) noexcept { return RB_Read_Byte(&handle_, &output) == RING_BUFFER_SUCCESS ; }
+    bool write(const uint8_t *input, uint32_t Length) noexcept
+    {
+        return RB_Write_String(&handle_, const_cast<uint8_t *>(input), Length) == RING_BUFFER_SUCCESS ;
+    }
+    bool read(uint8_t *output, uint32_t Length) noexcept { return RB_Read_String(&handle_, output, Length) == RING_BUFFER_SUCCESS ; }
+    bool discard(uint32_t Length) noexcept { return RB_Delete(&handle_, Length) == RING_BUFFER_SUCCESS ; }
+
+    //获取 C 结构体句柄，可直接传给 RB_* 接口
+    ring_buffer *c_handle() noexcept { return &handle_ ; }
+
+private:
+    ring_buffer handle_ ;
+    uint8_t storage_[N];
+};
+
+}//namespace ring_buffer_cpp
+
+#endif//#ifndef _RING_BUFFER_HPP_
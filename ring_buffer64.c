@@ -0,0 +1,194 @@
+/**
+ * \file ring_buffer64.c
+ * \brief 64位下标环形缓冲的实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "ring_buffer64.h"
+#include "ring_buffer_copy.h"
+
+//单次写入拷贝的最大长度，RB_Copy_In 的长度参数为 uint32_t，更长的写入分块拷贝
+#ifndef RB64_COPY_CHUNK
+#define RB64_COPY_CHUNK     0x80000000u
+#endif
+
+//拷贝数据到缓冲区，超过 RB64_COPY_CHUNK 时分块调用 RB_COPY_IN
+static void RB64_Copy_In(uint8_t *destination, const uint8_t *source, uint64_t Length)
+{
+    while(Length > RB64_COPY_CHUNK)
+    {
+        RB_COPY_IN(destination, source, RB64_COPY_CHUNK);
+        destination += RB64_COPY_CHUNK ;
+        source += RB64_COPY_CHUNK ;
+        Length -= RB64_COPY_CHUNK ;
+    }
+    RB_COPY_IN(destination, source, (uint32_t)Length);
+}
+
+/**
+ * \brief 初始化64位缓冲区
+ * \param[out] rb_handle: 待初始化的缓冲区结构体句柄
+ * \param[in] buffer_addr: 外部定义或 RB_Alloc_Huge 分配的缓冲区数组
+ * \param[in] buffer_size: 缓冲区数组空间
+ * \return 返回缓冲区初始化的结果
+ *      \arg RING_BUFFER_SUCCESS: 初始化成功
+ *      \arg RING_BUFFER_ERROR: 初始化失败
+*/
+uint8_t RB64_Init(ring_buffer64 *rb_handle, uint8_t *buffer_addr, uint64_t buffer_size)
+{
+    //缓冲区数组空间必须大于2且不超过地址空间
+    if(buffer_size < 2 || buffer_size > (uint64_t)SIZE_MAX)
+        return RING_BUFFER_ERROR ;
+    rb_handle->head = 0 ;
+    rb_handle->tail = 0 ;
+    rb_handle->Length = 0 ;
+    rb_handle->array_addr = buffer_addr ;
+    rb_handle->max_Length = buffer_size ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 从头指针开始删除指定长度的数据
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] Length: 要删除的长度
+ * \return 返回删除指定长度数据结果
+ *      \arg RING_BUFFER_SUCCESS: 删除成功
+ *      \arg RING_BUFFER_ERROR: 删除失败
+*/
+uint8_t RB64_Delete(ring_buffer64 *rb_handle, uint64_t Length)
+{
+    if(rb_handle->Length < Length)
+        return RING_BUFFER_ERROR ;
+    if(Length >= rb_handle->max_Length - rb_handle->head)
+        rb_handle->head = Length - (rb_handle->max_Length - rb_handle->head);
+    else
+        rb_handle->head += Length ;
+    rb_handle->Length -= Length ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 向缓冲区尾部写一个字节
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] data: 要写入的字节
+ * \return 返回缓冲区写字节的结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 写入失败
+*/
+uint8_t RB64_Write_Byte(ring_buffer64 *rb_handle, uint8_t data)
+{
+    if(rb_handle->Length == rb_handle->max_Length)
+        return RING_BUFFER_ERROR ;
+    *(rb_handle->array_addr + rb_handle->tail) = data ;
+    rb_handle->Length ++ ;
+    if(++rb_handle->tail == rb_handle->max_Length)
+        rb_handle->tail = 0 ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 从缓冲区头指针读取一个字节
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[out] output_addr: 读取的字节保存地址
+ * \return 返回读取状态
+ *      \arg RING_BUFFER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_ERROR: 读取失败
+*/
+uint8_t RB64_Read_Byte(ring_buffer64 *rb_handle, uint8_t *output_addr)
+{
+    if(!rb_handle->Length)
+        return RING_BUFFER_ERROR ;
+    *output_addr = *(rb_handle->array_addr + rb_handle->head);
+    rb_handle->Length -- ;
+    if(++rb_handle->head == rb_handle->max_Length)
+        rb_handle->head = 0 ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 向缓冲区尾部写指定长度的数据
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] input_addr: 待写入数据的基地址
+ * \param[in] write_Length: 要写入的字节数
+ * \return 返回缓冲区尾部写指定长度字节的结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 写入失败
+*/
+uint8_t RB64_Write_String(ring_buffer64 *rb_handle, uint8_t *input_addr, uint64_t write_Length)
+{
+    if(write_Length > rb_handle->max_Length - rb_handle->Length)
+        return RING_BUFFER_ERROR ;
+    uint64_t write_size_a = rb_handle->max_Length - rb_handle->tail ;
+    //如果顺序可用长度小于需写入的长度，需要将数据拆成两次分别写入
+    if(write_size_a < write_Length)
+    {
+        RB64_Copy_In(rb_handle->array_addr + rb_handle->tail, input_addr, write_size_a);
+        RB64_Copy_In(rb_handle->array_addr, input_addr + write_size_a, write_Length - write_size_a);
+        rb_handle->tail = write_Length - write_size_a ;
+    }
+    else
+    {
+        RB64_Copy_In(rb_handle->array_addr + rb_handle->tail, input_addr, write_Length);
+        rb_handle->tail += write_Length ;
+        if(rb_handle->tail == rb_handle->max_Length)
+            rb_handle->tail = 0 ;
+    }
+    rb_handle->Length += write_Length ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 从缓冲区头部读指定长度的数据，保存到指定的地址
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[out] output_addr: 读取的数据保存地址
+ * \param[in] read_Length: 要读取的字节数
+ * \return 返回缓冲区头部读指定长度字节的结果
+ *      \arg RING_BUFFER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_ERROR: 读取失败
+*/
+uint8_t RB64_Read_String(ring_buffer64 *rb_handle, uint8_t *output_addr, uint64_t read_Length)
+{
+    if(read_Length > rb_handle->Length)
+        return RING_BUFFER_ERROR ;
+    uint64_t Read_size_a = rb_handle->max_Length - rb_handle->head ;
+    if(Read_size_a < read_Length)
+    {
+        memcpy(output_addr, rb_handle->array_addr + rb_handle->head, (size_t)Read_size_a);
+        memcpy(output_addr + Read_size_a, rb_handle->array_addr, (size_t)(read_Length - Read_size_a));
+        rb_handle->head = read_Length - Read_size_a ;
+    }
+    else
+    {
+        memcpy(output_addr, rb_handle->array_addr + rb_handle->head, (size_t)read_Length);
+        rb_handle->head += read_Length ;
+        if(rb_handle->head == rb_handle->max_Length)
+            rb_handle->head = 0 ;
+    }
+    rb_handle->Length -= read_Length ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 获取缓冲区里已储存的数据长度
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \return 返回缓冲区里已储存的数据长度
+*/
+uint64_t RB64_Get_Length(ring_buffer64 *rb_handle)
+{
+    return rb_handle->Length ;
+}
+
+/**
+ * \brief 获取缓冲区可用储存空间
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \return 返回缓冲区可用储存空间
+*/
+uint64_t RB64_Get_FreeSize(ring_buffer64 *rb_handle)
+{
+    return rb_handle->max_Length - rb_handle->Length ;
+}
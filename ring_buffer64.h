@@ -0,0 +1,42 @@
+/**
+ * \file ring_buffer64.h
+ * \brief 64位下标环形缓冲相关定义与声明，单个缓冲区可超过 4GiB
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER64_H_
+#define _RING_BUFFER64_H_
+
+#include <stdint.h>
+#include "ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//64位环形缓冲区结构体，字段含义与 ring_buffer 相同
+typedef struct
+{
+    uint64_t head ;             //操作头指针
+    uint64_t tail ;             //操作尾指针
+    uint64_t Length ;           //已储存的数据量
+    uint8_t *array_addr ;       //缓冲区储存数组基地址
+    uint64_t max_Length ;       //缓冲区最大可储存数据量
+}ring_buffer64;
+
+uint8_t RB64_Init(ring_buffer64 *rb_handle, uint8_t *buffer_addr, uint64_t buffer_size);           //初始化64位环形缓冲区
+uint8_t RB64_Delete(ring_buffer64 *rb_handle, uint64_t Length);                                    //从头指针开始删除指定长度的数据
+uint8_t RB64_Write_Byte(ring_buffer64 *rb_handle, uint8_t data);                                   //向缓冲区尾指针写一个字节
+uint8_t RB64_Write_String(ring_buffer64 *rb_handle, uint8_t *input_addr, uint64_t write_Length);   //向缓冲区尾指针写指定长度数据
+uint8_t RB64_Read_Byte(ring_buffer64 *rb_handle, uint8_t *output_addr);                            //从缓冲区头指针读一个字节
+uint8_t RB64_Read_String(ring_buffer64 *rb_handle, uint8_t *output_addr, uint64_t read_Length);    //从缓冲区头指针读指定长度数据
+uint64_t RB64_Get_Length(ring_buffer64 *rb_handle);                                                //获取缓冲区里已储存的数据长度
+uint64_t RB64_Get_FreeSize(ring_buffer64 *rb_handle);                                              //获取缓冲区可用储存空间
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER64_H_
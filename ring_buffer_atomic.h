@@ -0,0 +1,35 @@
+/**
+ * \file ring_buffer_atomic.h
+ * \brief 无锁版本共用的原子类型与缓存行对齐定义，使含原子成员的结构体在 C 与 C++ 中都能解析
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_ATOMIC_H_
+#define _RING_BUFFER_ATOMIC_H_
+
+#include <stdint.h>
+
+//缓存行大小，各线程独占的状态按此对齐以避免伪共享
+#ifndef RB_CACHE_LINE_SIZE
+#define RB_CACHE_LINE_SIZE      64
+#endif
+
+//C 使用 C11 的 _Atomic 与 _Alignas；C++ 没有 _Atomic 关键字，映射为 std::atomic 与 alignas
+//GCC、Clang 上 std::atomic<T> 与 _Atomic(T) 大小、对齐与表示相同，两侧看到的结构体布局一致，
+//C++ 代码可以定义并持有这些结构体，读写仍通过 C 接口完成
+#ifdef __cplusplus
+#include <atomic>
+#define RB_ATOMIC(type)         std::atomic<type>
+#define RB_ALIGNAS(size)        alignas(size)
+static_assert(sizeof(std::atomic<uint8_t>) == sizeof(uint8_t) && sizeof(std::atomic<uint32_t>) == sizeof(uint32_t)\
+              && sizeof(std::atomic<uint64_t>) == sizeof(uint64_t),
+              "std::atomic must match the C11 _Atomic layout used by ring_buffer");
+#else
+#include <stdatomic.h>
+#define RB_ATOMIC(type)         _Atomic(type)
+#define RB_ALIGNAS(size)        _Alignas(size)
+#endif
+
+#endif//#ifndef _RING_BUFFER_ATOMIC_H_
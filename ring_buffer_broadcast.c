@@ -0,0 +1,315 @@
+/**
+ * \file ring_buffer_broadcast.c
+ * \brief 单生产者多读者广播环形缓冲的实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "ring_buffer_broadcast.h"
+
+/*
+ * 每个字节只写入一次，所有读者直接从同一个数组读取；
+ * 阻塞读者的读指针限制生产者的可用空间，有损读者不限制生产者，
+ * 生产者在写入数据前先发布 reserve，有损读者读完数据后再检查 reserve，
+ * 读取期间数据被覆盖时丢弃本次结果并跳到最旧的有效数据(与 seqlock 的校验方式相同)
+ * 有损读者的落后量超过 2^31 字节时无法识别，需要保证读者不会长期停止读取
+*/
+
+//获取已注册的读者，reader_Id 无效或未注册时返回NULL
+static ring_buffer_broadcast_reader *RBB_Get_Reader(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id)
+{
+    if(reader_Id >= RB_BROADCAST_MAX_READERS)
+        return NULL ;
+    ring_buffer_broadcast_reader *reader = &(rbb_handle->reader[reader_Id]);
+    if(atomic_load_explicit(&reader->state, memory_order_acquire) != 1)
+        return NULL ;
+    return reader ;
+}
+
+//(生产者)获取最慢的阻塞读者的读指针，没有阻塞读者时返回写指针
+static uint32_t RBB_Slowest_Head(ring_buffer_broadcast *rbb_handle, uint32_t tail)
+{
+    uint32_t max_distance = 0 ;
+    //与注册读者时的"先置状态再读写指针"配对，保证新读者要么被看到，要么从更新的写指针开始
+    atomic_thread_fence(memory_order_seq_cst);
+    for(uint32_t i = 0; i < RB_BROADCAST_MAX_READERS; i++)
+    {
+        ring_buffer_broadcast_reader *reader = &(rbb_handle->reader[i]);
+        //acquire 与注册时状态的写入配对，读到已注册时一定能看到该读者的策略
+        if(atomic_load_explicit(&reader->state, memory_order_acquire) != 1 ||\
+           atomic_load_explicit(&reader->policy, memory_order_relaxed) != RB_BROADCAST_BLOCKING)
+            continue ;
+        //acquire 保证读者读完数据之后生产者才会覆盖
+        uint32_t distance = tail - atomic_load_explicit(&reader->head, memory_order_acquire);
+        if(distance > max_distance)
+            max_distance = distance ;
+    }
+    return tail - max_distance ;
+}
+
+//(有损读者)检查 [head, ...) 是否已被覆盖或正在被覆盖，是则跳到最旧的有效数据并返回 RING_BUFFER_ERROR
+static uint8_t RBB_Check_Overrun(ring_buffer_broadcast *rbb_handle, ring_buffer_broadcast_reader *reader, uint32_t head)
+{
+    uint32_t reserve = atomic_load_explicit(&rbb_handle->reserve, memory_order_relaxed);
+    if(reserve - head <= rbb_handle->max_Length)
+        return RING_BUFFER_SUCCESS ;
+    uint32_t oldest = reserve - rbb_handle->max_Length ;
+    //只由该读者自己累加，relaxed 读取加写入即可，其它线程通过 RBB_Get_Lost 读取
+    atomic_store_explicit(&reader->lost, atomic_load_explicit(&reader->lost, memory_order_relaxed) + (oldest - head), memory_order_relaxed);
+    atomic_store_explicit(&reader->head, oldest, memory_order_relaxed);
+    return RING_BUFFER_ERROR ;
+}
+
+/**
+ * \brief 初始化广播环形缓冲区
+ * \param[out] rbb_handle: 待初始化的缓冲区结构体句柄
+ * \param[in] buffer_addr: 外部定义的缓冲区数组，类型必须为 uint8_t
+ * \param[in] buffer_size: 外部定义的缓冲区数组空间，必须为2的幂
+ * \return 返回缓冲区初始化的结果
+ *      \arg RING_BUFFER_SUCCESS: 初始化成功
+ *      \arg RING_BUFFER_ERROR: 初始化失败
+ * \note 初始化须在生产者与读者线程开始访问之前完成
+*/
+uint8_t RBB_Init(ring_buffer_broadcast *rbb_handle, uint8_t *buffer_addr, uint32_t buffer_size)
+{
+    if(buffer_size < 2 || buffer_size > 0x80000000 || (buffer_size & (buffer_size - 1)))
+        return RING_BUFFER_ERROR ;
+    atomic_init(&rbb_handle->tail, 0);
+    atomic_init(&rbb_handle->reserve, 0);
+    rbb_handle->head_cache = 0 ;
+    rbb_handle->array_addr = buffer_addr ;
+    rbb_handle->max_Length = buffer_size ;
+    rbb_handle->mask = buffer_size - 1 ;
+    for(uint32_t i = 0; i < RB_BROADCAST_MAX_READERS; i++)
+    {
+        atomic_init(&rbb_handle->reader[i].head, 0);
+        atomic_init(&rbb_handle->reader[i].state, 0);
+        atomic_init(&rbb_handle->reader[i].policy, RB_BROADCAST_BLOCKING);
+        atomic_init(&rbb_handle->reader[i].lost, 0);
+    }
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 注册读者，读者从注册时的写指针开始读取，之前写入的数据不可见
+ * \param[out] rbb_handle: 缓冲区结构体句柄
+ * \param[in] policy: 读者策略，RB_BROADCAST_BLOCKING 或 RB_BROADCAST_LOSSY
+ * \param[out] output_Id: 分配的读者编号
+ * \return 返回注册结果
+ *      \arg RING_BUFFER_SUCCESS: 注册成功
+ *      \arg RING_BUFFER_ERROR: 注册失败，已达到 RB_BROADCAST_MAX_READERS
+ * \note 可在生产者运行期间由任意线程调用
+*/
+uint8_t RBB_Add_Reader(ring_buffer_broadcast *rbb_handle, uint8_t policy, uint32_t *output_Id)
+{
+    for(uint32_t i = 0; i < RB_BROADCAST_MAX_READERS; i++)
+    {
+        ring_buffer_broadcast_reader *reader = &(rbb_handle->reader[i]);
+        uint32_t expected = 0 ;
+        if(!atomic_compare_exchange_strong(&reader->state, &expected, 2))
+            continue ;
+        //策略在状态置为已注册之前写入，由状态的写入发布给生产者
+        atomic_store_explicit(&reader->policy, policy, memory_order_relaxed);
+        atomic_store_explicit(&reader->lost, 0, memory_order_relaxed);
+        atomic_store_explicit(&reader->head, atomic_load_explicit(&rbb_handle->tail, memory_order_relaxed), memory_order_relaxed);
+        //先置为已注册再重新读取写指针，生产者此后计算空间时一定会考虑该读者
+        atomic_store_explicit(&reader->state, 1, memory_order_seq_cst);
+        atomic_store_explicit(&reader->head, atomic_load_explicit(&rbb_handle->tail, memory_order_seq_cst), memory_order_release);
+        *output_Id = i ;
+        return RING_BUFFER_SUCCESS ;
+    }
+    return RING_BUFFER_ERROR ;
+}
+
+/**
+ * \brief 注销读者，阻塞读者注销后不再限制生产者
+ * \param[out] rbb_handle: 缓冲区结构体句柄
+ * \param[in] reader_Id: 读者编号
+ * \return 返回注销结果
+ *      \arg RING_BUFFER_SUCCESS: 注销成功
+ *      \arg RING_BUFFER_ERROR: 注销失败，读者未注册
+*/
+uint8_t RBB_Remove_Reader(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id)
+{
+    ring_buffer_broadcast_reader *reader = RBB_Get_Reader(rbb_handle, reader_Id);
+    if(reader == NULL)
+        return RING_BUFFER_ERROR ;
+    atomic_store_explicit(&reader->state, 0, memory_order_release);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)向缓冲区尾部写指定长度的数据，所有读者均可读到
+ * \param[out] rbb_handle: 缓冲区结构体句柄
+ * \param[in] input_addr: 待写入数据的基地址
+ * \param[in] write_Length: 要写入的字节数
+ * \return 返回写入结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 写入失败，最慢的阻塞读者没有读完足够的数据
+*/
+uint8_t RBB_Write_String(ring_buffer_broadcast *rbb_handle, uint8_t *input_addr, uint32_t write_Length)
+{
+    uint32_t tail = atomic_load_explicit(&rbb_handle->tail, memory_order_relaxed);
+    //先使用缓存的最慢读指针判断，空间不足时再重新扫描所有读者
+    if(rbb_handle->max_Length - (tail - rbb_handle->head_cache) < write_Length)
+    {
+        rbb_handle->head_cache = RBB_Slowest_Head(rbb_handle, tail);
+        if(rbb_handle->max_Length - (tail - rbb_handle->head_cache) < write_Length)
+            return RING_BUFFER_ERROR ;
+    }
+    //先发布即将覆盖的范围，再写入数据
+    atomic_store_explicit(&rbb_handle->reserve, tail + write_Length, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    uint32_t index = tail & rbb_handle->mask ;
+    if(rbb_handle->max_Length - index < write_Length)
+    {
+        uint32_t write_size_a = rbb_handle->max_Length - index ;
+        memcpy(rbb_handle->array_addr + index, input_addr, write_size_a);
+        memcpy(rbb_handle->array_addr, input_addr + write_size_a, write_Length - write_size_a);
+    }
+    else memcpy(rbb_handle->array_addr + index, input_addr, write_Length);
+    atomic_store_explicit(&rbb_handle->tail, tail + write_Length, memory_order_release);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (读者)获取从读指针开始、指定长度的未读数据所在区域，不拷贝数据
+ * \param[out] rbb_handle: 缓冲区结构体句柄
+ * \param[in] reader_Id: 读者编号
+ * \param[in] peek_Length: 需要获取的字节数
+ * \param[out] region: 数据区域的描述，跨越数组末尾时分为a、b两段
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_SUCCESS: 获取成功
+ *      \arg RING_BUFFER_ERROR: 获取失败，未读数据不足或读者未注册
+ * \note 有损读者落后超过缓冲区空间时先跳到最旧的有效数据；处理完成后必须调用 RBB_Read_Consume，
+ *       有损读者需以其返回值确认处理期间数据没有被覆盖
+*/
+uint8_t RBB_Read_Peek(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id, uint32_t peek_Length, ring_buffer_region *region)
+{
+    ring_buffer_broadcast_reader *reader = RBB_Get_Reader(rbb_handle, reader_Id);
+    if(reader == NULL)
+        return RING_BUFFER_ERROR ;
+    uint32_t head = atomic_load_explicit(&reader->head, memory_order_relaxed);
+    if(atomic_load_explicit(&reader->policy, memory_order_relaxed) == RB_BROADCAST_LOSSY)
+    {
+        RBB_Check_Overrun(rbb_handle, reader, head);
+        head = atomic_load_explicit(&reader->head, memory_order_relaxed);
+    }
+    //写指针在跳过之后读取，保证不小于跳过后的读指针
+    uint32_t tail = atomic_load_explicit(&rbb_handle->tail, memory_order_acquire);
+    if(tail - head < peek_Length)
+        return RING_BUFFER_ERROR ;
+    uint32_t index = head & rbb_handle->mask ;
+    uint32_t size_a = rbb_handle->max_Length - index ;
+    region->addr_a = rbb_handle->array_addr + index ;
+    if(peek_Length > size_a)
+    {
+        region->Length_a = size_a ;
+        region->addr_b = rbb_handle->array_addr ;
+        region->Length_b = peek_Length - size_a ;
+    }
+    else
+    {
+        region->Length_a = peek_Length ;
+        region->addr_b = NULL ;
+        region->Length_b = 0 ;
+    }
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (读者)释放已处理的数据，推进该读者的读指针
+ * \param[out] rbb_handle: 缓冲区结构体句柄
+ * \param[in] reader_Id: 读者编号
+ * \param[in] consume_Length: 需要释放的字节数
+ * \return 返回释放结果
+ *      \arg RING_BUFFER_SUCCESS: 释放成功
+ *      \arg RING_BUFFER_ERROR: 释放失败，未读数据不足、读者未注册，或(有损读者)数据在处理期间已被覆盖，
+ *                              此时读指针已跳到最旧的有效数据，本次处理的结果应当丢弃
+*/
+uint8_t RBB_Read_Consume(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id, uint32_t consume_Length)
+{
+    ring_buffer_broadcast_reader *reader = RBB_Get_Reader(rbb_handle, reader_Id);
+    if(reader == NULL)
+        return RING_BUFFER_ERROR ;
+    uint32_t head = atomic_load_explicit(&reader->head, memory_order_relaxed);
+    if(atomic_load_explicit(&reader->policy, memory_order_relaxed) == RB_BROADCAST_LOSSY)
+    {
+        //保证之前对数据的读取先于对 reserve 的读取完成
+        atomic_thread_fence(memory_order_acquire);
+        if(!RBB_Check_Overrun(rbb_handle, reader, head))
+            return RING_BUFFER_ERROR ;
+    }
+    if(atomic_load_explicit(&rbb_handle->tail, memory_order_acquire) - head < consume_Length)
+        return RING_BUFFER_ERROR ;
+    //release 保证读完数据之后生产者才能看到新的读指针
+    atomic_store_explicit(&reader->head, head + consume_Length, memory_order_release);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (读者)从该读者的读指针读指定长度的数据，保存到指定的地址
+ * \param[out] rbb_handle: 缓冲区结构体句柄
+ * \param[in] reader_Id: 读者编号
+ * \param[out] output_addr: 读取的数据保存地址
+ * \param[in] read_Length: 要读取的字节数
+ * \return 返回读取结果
+ *      \arg RING_BUFFER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_ERROR: 读取失败，未读数据不足，或(有损读者)读取期间数据被覆盖
+*/
+uint8_t RBB_Read_String(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id, uint8_t *output_addr, uint32_t read_Length)
+{
+    ring_buffer_region region ;
+    if(!RBB_Read_Peek(rbb_handle, reader_Id, read_Length, &region))
+        return RING_BUFFER_ERROR ;
+    memcpy(output_addr, region.addr_a, region.Length_a);
+    if(region.Length_b)
+        memcpy(output_addr + region.Length_a, region.addr_b, region.Length_b);
+    return RBB_Read_Consume(rbb_handle, reader_Id, read_Length);
+}
+
+/**
+ * \brief 获取读者未读的数据长度
+ * \param[in] rbb_handle: 缓冲区结构体句柄
+ * \param[in] reader_Id: 读者编号
+ * \return 返回未读的数据长度，读者未注册时返回0；有损读者最多返回缓冲区空间
+*/
+uint32_t RBB_Get_Length(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id)
+{
+    ring_buffer_broadcast_reader *reader = RBB_Get_Reader(rbb_handle, reader_Id);
+    if(reader == NULL)
+        return 0 ;
+    uint32_t head = atomic_load_explicit(&reader->head, memory_order_relaxed);
+    uint32_t Length = atomic_load_explicit(&rbb_handle->tail, memory_order_acquire) - head ;
+    return (Length > rbb_handle->max_Length) ? rbb_handle->max_Length : Length ;
+}
+
+/**
+ * \brief (生产者)获取可用储存空间，由最慢的阻塞读者决定
+ * \param[in] rbb_handle: 缓冲区结构体句柄
+ * \return 返回可用储存空间
+*/
+uint32_t RBB_Get_FreeSize(ring_buffer_broadcast *rbb_handle)
+{
+    uint32_t tail = atomic_load_explicit(&rbb_handle->tail, memory_order_relaxed);
+    return rbb_handle->max_Length - (tail - RBB_Slowest_Head(rbb_handle, tail));
+}
+
+/**
+ * \brief 获取有损读者因落后过多被跳过的字节总数
+ * \param[in] rbb_handle: 缓冲区结构体句柄
+ * \param[in] reader_Id: 读者编号
+ * \return 返回跳过的字节总数，读者未注册时返回0
+ * \note 可在任意线程调用，与该读者的读取并发时返回调用瞬间的快照
+*/
+uint64_t RBB_Get_Lost(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id)
+{
+    ring_buffer_broadcast_reader *reader = RBB_Get_Reader(rbb_handle, reader_Id);
+    if(reader == NULL)
+        return 0 ;
+    return atomic_load_explicit(&reader->lost, memory_order_relaxed);
+}
@@ -0,0 +1,68 @@
+/**
+ * \file ring_buffer_broadcast.h
+ * \brief 单生产者多读者广播环形缓冲相关定义与声明
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_BROADCAST_H_
+#define _RING_BUFFER_BROADCAST_H_
+
+#include <stdint.h>
+#include "ring_buffer.h"
+#include "ring_buffer_atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//最多可注册的读者数量
+#ifndef RB_BROADCAST_MAX_READERS
+#define RB_BROADCAST_MAX_READERS    8
+#endif
+
+//读者策略
+#define RB_BROADCAST_BLOCKING   0x00    //阻塞读者：未读的数据不会被覆盖，最慢的阻塞读者决定生产者的可用空间
+#define RB_BROADCAST_LOSSY      0x01    //有损读者：不限制生产者，落后超过缓冲区空间时跳到最旧的有效数据
+
+//读者状态，每个读者独占缓存行，读指针只由该读者修改
+typedef struct
+{
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) head ;   //读指针
+    RB_ATOMIC(uint32_t) state ;                                 //0 空闲，1 已注册，2 注册中
+    RB_ATOMIC(uint8_t) policy ;                                 //读者策略，生产者在状态为已注册时读取
+    RB_ATOMIC(uint64_t) lost ;                                  //(有损读者)被覆盖而跳过的字节总数，只由该读者写入，任意线程可读取
+}ring_buffer_broadcast_reader;
+
+//广播环形缓冲区结构体
+//数组空间必须为2的幂，head、tail 为自由递增的 uint32_t 计数(自然溢出)，二者之差即为该读者未读的数据量
+typedef struct
+{
+    //生产者独占缓存行
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) tail ;   //写指针，已发布的数据末尾
+    RB_ATOMIC(uint32_t) reserve ;                               //正在写入的数据末尾，有损读者据此判断读到的数据是否已被覆盖
+    uint32_t head_cache ;                                       //生产者缓存的最慢阻塞读者读指针
+    //初始化后只读的共享参数
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) uint8_t *array_addr ;        //缓冲区储存数组基地址
+    uint32_t max_Length ;                                       //缓冲区最大可储存数据量
+    uint32_t mask ;                                             //下标掩码(max_Length - 1)
+    ring_buffer_broadcast_reader reader[RB_BROADCAST_MAX_READERS] ;
+}ring_buffer_broadcast;
+
+uint8_t RBB_Init(ring_buffer_broadcast *rbb_handle, uint8_t *buffer_addr, uint32_t buffer_size);                 //初始化广播环形缓冲区
+uint8_t RBB_Add_Reader(ring_buffer_broadcast *rbb_handle, uint8_t policy, uint32_t *output_Id);                 //注册读者，从当前写指针开始读取
+uint8_t RBB_Remove_Reader(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id);                               //注销读者
+uint8_t RBB_Write_String(ring_buffer_broadcast *rbb_handle, uint8_t *input_addr, uint32_t write_Length);        //(生产者)写指定长度数据
+uint8_t RBB_Read_String(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id, uint8_t *output_addr, uint32_t read_Length); //(读者)读指定长度数据
+uint8_t RBB_Read_Peek(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id, uint32_t peek_Length, ring_buffer_region *region); //(读者)获取未读数据所在区域(不拷贝)
+uint8_t RBB_Read_Consume(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id, uint32_t consume_Length);       //(读者)释放已处理的数据
+uint32_t RBB_Get_Length(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id);                                  //获取读者未读的数据长度
+uint32_t RBB_Get_FreeSize(ring_buffer_broadcast *rbb_handle);                                                    //获取生产者可用储存空间
+uint64_t RBB_Get_Lost(ring_buffer_broadcast *rbb_handle, uint32_t reader_Id);                                    //获取有损读者跳过的字节总数
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_BROADCAST_H_
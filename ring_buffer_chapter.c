@@ -7,7 +7,75 @@
 */
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 #include "ring_buffer_chapter.h"
+#include "ring_buffer_chapter_internal.h"
+#include "ring_buffer_copy.h"
+
+//读取分段环中第 chapter_index 条记录(第 chapter_index 个分段结束处的绝对偏移)，调用前需确认记录存在
+static uint32_t RBC_Get_Chapter_End(ring_buffer_chapter *rbc_handle, uint32_t chapter_index)
+{
+    ring_buffer_region region ;
+    uint32_t position = chapter_index * 4 ;
+    uint32_t end = 0 ;
+    RB_Read_Peek(&(rbc_handle->chapter_handle), position + 4, &region);
+    //记录可能被分段环数组末尾拆成两部分
+    if(position + 4 <= region.Length_a)
+        memcpy(&end, region.addr_a + position, 4);
+    else if(position >= region.Length_a)
+        memcpy(&end, region.addr_b + (position - region.Length_a), 4);
+    else
+    {
+        uint32_t size_a = region.Length_a - position ;
+        memcpy(&end, region.addr_a + position, size_a);
+        memcpy((uint8_t *)&end + size_a, region.addr_b, 4 - size_a);
+    }
+    return end ;
+}
+
+/**
+ * \brief (覆盖模式)为写入 write_Length 字节与 chapter_Number 条分段记录腾出空间，从头分段开始丢弃尽量少的完整分段
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] write_Length: 需要的数据环空间
+ * \param[in] chapter_Number: 需要的分段记录条数
+ * \return 返回腾出空间的结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 空间已足够
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 丢弃全部完整分段也放不下，缓冲区保持不变
+ * \note 尾分段暂存的数据不会被丢弃；所有检查在丢弃之前完成，丢弃的分段数量由二分查找确定
+*/
+uint8_t RBC_Make_Room(ring_buffer_chapter *rbc_handle, uint32_t write_Length, uint32_t chapter_Number)
+{
+    uint32_t number = RBC_Get_Chapter_Number(rbc_handle);
+    //分段环空间不足时至少丢弃差额数量的分段，为本次写入的分段记录留出位置
+    uint32_t free_number = RBC_Get_Chapter_Free_Size(rbc_handle);
+    uint32_t min_number = (free_number < chapter_Number) ? (chapter_Number - free_number) : 0 ;
+    uint32_t free_size = RB_Get_FreeSize(&(rbc_handle->base_handle));
+    uint32_t need = (free_size < write_Length) ? (write_Length - free_size) : 0 ;
+    if(!need && !min_number)
+        return RING_BUFFER_CHAPTER_SUCCESS ;
+    if(min_number > number || (need && (!number || RBC_Get_Chapter_End(rbc_handle, number - 1) - rbc_handle->head_offset < need)))
+        return RING_BUFFER_CHAPTER_ERROR ;//丢弃全部完整分段也放不下
+    uint32_t low = min_number ;
+    if(need)
+    {
+        //各分段结束偏移单调递增，二分查找释放空间不小于 need 的最少分段数量
+        uint32_t high = number ;
+        low = 1 ;
+        while(low < high)
+        {
+            uint32_t middle = low + (high - low) / 2 ;
+            if(RBC_Get_Chapter_End(rbc_handle, middle - 1) - rbc_handle->head_offset >= need)
+                high = middle ;
+            else
+                low = middle + 1 ;
+        }
+        if(low < min_number)
+            low = min_number ;
+    }
+    RBC_Delete(rbc_handle, low);
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
 
 /**
  * \brief 初始化带分段功能的环形缓冲区
@@ -19,6 +87,8 @@
  * \return 返回缓冲区初始化的结果
  *      \arg RING_BUFFER_CHAPTER_SUCCESS: 初始化成功
  *      \arg RING_BUFFER_CHAPTER_ERROR: 初始化失败
+ * \note 每个已结尾的分段占用分段环4字节，最多可同时储存 chapter_buffer_size / 4 个分段；
+ *       旧版本把头分段长度移入句柄，可多存一个分段，按旧规则确定数组大小时需要多留4字节
 */
 uint8_t RBC_Init(ring_buffer_chapter *rbc_handle,\
                 uint8_t *base_buffer_addr, uint32_t base_buffer_size,\
@@ -28,9 +98,27 @@ uint8_t RBC_Init(ring_buffer_chapter *rbc_handle,\
         return RING_BUFFER_CHAPTER_ERROR ;
     if(!RB_Init(&(rbc_handle->chapter_handle), (uint8_t *)chapter_buffer_addr, chapter_buffer_size))
         return RING_BUFFER_CHAPTER_ERROR ;
-    rbc_handle->head_chapter_length = 0 ;
+    rbc_handle->head_offset = 0 ;
     rbc_handle->tail_chapter_length = 0 ;
-    rbc_handle->init_flag = 1 ;
+    rbc_handle->flags = 0 ;
+    rbc_handle->stats = NULL ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 开启或关闭覆盖模式，开启后空间不足时从头分段开始丢弃最旧的完整分段，直到新数据可以写入
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] enable: 1 开启，0 关闭
+ * \return 返回设置结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 设置成功
+ * \note 尾分段暂存的数据不会被丢弃，因此单个分段的长度仍然不能超过数据环的空间
+*/
+uint8_t RBC_Set_Overwrite(ring_buffer_chapter *rbc_handle, uint8_t enable)
+{
+    if(enable)
+        rbc_handle->flags |= RING_BUFFER_CHAPTER_FLAG_OVERWRITE ;
+    else
+        rbc_handle->flags &= (uint8_t)~RING_BUFFER_CHAPTER_FLAG_OVERWRITE ;
     return RING_BUFFER_CHAPTER_SUCCESS ;
 }
 
@@ -44,10 +132,13 @@ uint8_t RBC_Init(ring_buffer_chapter *rbc_handle,\
 */
 uint8_t RBC_Write_Byte(ring_buffer_chapter *rbc_handle, uint8_t data)
 {
-    if(!RBC_Get_Chapter_Free_Size(rbc_handle)) //检查分段环剩余空间是否允许新增一条分段记录
-        return RING_BUFFER_CHAPTER_ERROR ;
-    if(!RB_Write_Byte(&(rbc_handle->base_handle), data)) //向数据环尾指针写入一个字节
+    if(((rbc_handle->flags & RING_BUFFER_CHAPTER_FLAG_OVERWRITE) && !RBC_Make_Room(rbc_handle, 1, 1)) //覆盖模式下先丢弃最旧的分段腾出空间
+        || !RBC_Get_Chapter_Free_Size(rbc_handle) //检查分段环剩余空间是否允许新增一条分段记录
+        || !RB_Write_Byte(&(rbc_handle->base_handle), data)) //向数据环尾指针写入一个字节
+    {
+        RBC_STATS_ADD(rbc_handle, write_rejected, 1);
         return RING_BUFFER_CHAPTER_ERROR ;
+    }
     rbc_handle->tail_chapter_length ++ ; //尾分段暂存字节数加1
     return RING_BUFFER_CHAPTER_SUCCESS ;
 }
@@ -63,14 +154,124 @@ uint8_t RBC_Write_Byte(ring_buffer_chapter *rbc_handle, uint8_t data)
 */
 uint8_t RBC_Write_String(ring_buffer_chapter *rbc_handle, uint8_t *input_addr, uint32_t write_Length)
 {
-    if(!RBC_Get_Chapter_Free_Size(rbc_handle)) //检查分段环剩余空间是否允许新增一条分段记录
+    if(((rbc_handle->flags & RING_BUFFER_CHAPTER_FLAG_OVERWRITE) && !RBC_Make_Room(rbc_handle, write_Length, 1)) //覆盖模式下先丢弃最旧的分段腾出空间
+        || !RBC_Get_Chapter_Free_Size(rbc_handle) //检查分段环剩余空间是否允许新增一条分段记录
+        || !RB_Write_String(&(rbc_handle->base_handle), input_addr, write_Length)) //向数据环尾指针写入指定长度数据
+    {
+        RBC_STATS_ADD(rbc_handle, write_rejected, 1);
         return RING_BUFFER_CHAPTER_ERROR ;
-    if(!RB_Write_String(&(rbc_handle->base_handle), input_addr, write_Length)) //向数据环尾指针写入指定长度数据
-        return RING_BUFFER_CHAPTER_ERROR;               
+    }
     rbc_handle->tail_chapter_length += write_Length ; //累加新增的尾分段暂存字节数
     return RING_BUFFER_CHAPTER_SUCCESS ;
 }
 
+/**
+ * \brief 预留尾分段之后指定长度的可写区域，供调用者直接写入数据
+ * \param[in] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] reserve_Length: 需要预留的字节数
+ * \param[out] region: 预留区域的描述，跨越数组末尾时分为a、b两段
+ * \return 返回预留结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 预留成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 预留失败
+*/
+uint8_t RBC_Write_Reserve(ring_buffer_chapter *rbc_handle, uint32_t reserve_Length, ring_buffer_region *region)
+{
+    if(!RBC_Get_Chapter_Free_Size(rbc_handle)) //检查分段环剩余空间是否允许新增一条分段记录
+        return RING_BUFFER_CHAPTER_ERROR ;
+    if(!RB_Write_Reserve(&(rbc_handle->base_handle), reserve_Length, region))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 提交已直接写入预留区域的数据，计入当前尾分段
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] commit_Length: 实际写入的字节数
+ * \return 返回提交结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 提交成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 提交失败
+*/
+uint8_t RBC_Write_Commit(ring_buffer_chapter *rbc_handle, uint32_t commit_Length)
+{
+    if(!RBC_Get_Chapter_Free_Size(rbc_handle))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    if(!RB_Write_Commit(&(rbc_handle->base_handle), commit_Length))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    rbc_handle->tail_chapter_length += commit_Length ; //累加新增的尾分段暂存字节数
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 将多段数据按顺序拼接拷贝进预留区域，区域跨越数组末尾时从a段接续到b段
+ * \param[in] region: RB_Write_Reserve 等接口返回的可写区域，长度须不小于各数据段长度之和
+ * \param[in] vector: 待拷贝的数据段描述数组，允许长度为0的数据段
+ * \param[in] vector_Number: 数据段数量
+ * \note 库内部函数，供分段环与分段队列的批量写入共用；与其他写入路径相同经过 RB_COPY_IN，
+ *       定义 RING_BUFFER_USE_COPY_KERNEL 时大块数据段使用非临时存储
+*/
+void RBC_Copy_Vector(const ring_buffer_region *region, const ring_buffer_vector *vector, uint32_t vector_Number)
+{
+    uint8_t *addr = region->addr_a ;
+    uint32_t remain = region->Length_a ;
+    for(uint32_t i = 0; i < vector_Number; i++)
+    {
+        uint8_t *input_addr = vector[i].addr ;
+        uint32_t Length = vector[i].Length ;
+        if(Length > remain)
+        {
+            RB_COPY_IN(addr, input_addr, remain);
+            input_addr += remain ;
+            Length -= remain ;
+            addr = region->addr_b ;
+            remain = region->Length_b ;
+        }
+        RB_COPY_IN(addr, input_addr, Length);
+        addr += Length ;
+        remain -= Length ;
+    }
+}
+
+/**
+ * \brief 将多段数据依次写入当前尾分段并结尾，只做一次容量检查，全部写入并完成分段记录，或不做任何修改
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] vector: 待写入的数据段描述数组，按顺序拼接，允许长度为0的数据段
+ * \param[in] vector_Number: 数据段数量
+ * \return 返回写入结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 写入并结尾成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 写入失败，数据环或分段环空间不足，或分段中没有任何数据
+ * \note 尾分段中已暂存的数据会与本次写入的数据合并为同一个分段；覆盖模式下先确认丢弃完整分段后
+ *       数据与分段记录的空间均足够，再按总长度一次性腾出空间，写入失败时不会丢弃任何分段
+*/
+uint8_t RBC_Write_Chapter_Vector(ring_buffer_chapter *rbc_handle, const ring_buffer_vector *vector, uint32_t vector_Number)
+{
+    ring_buffer_region region ;
+    uint32_t total = 0 ;
+    //先计算总长度，超过数据环空间时直接失败
+    for(uint32_t i = 0; i < vector_Number; i++)
+    {
+        if(vector[i].Length > rbc_handle->base_handle.max_Length - total)
+        {
+            RBC_STATS_ADD(rbc_handle, write_rejected, 1);
+            return RING_BUFFER_CHAPTER_ERROR ;
+        }
+        total += vector[i].Length ;
+    }
+    //数据环与分段环只检查一次，检查通过后后续步骤不会失败；
+    //覆盖模式下 RBC_Make_Room 在丢弃之前同时确认数据与分段记录的空间，放不下时不丢弃任何分段，成功后以下两项检查必然通过
+    if(!(total + rbc_handle->tail_chapter_length)
+        || ((rbc_handle->flags & RING_BUFFER_CHAPTER_FLAG_OVERWRITE) && !RBC_Make_Room(rbc_handle, total, 1))
+        || !RBC_Get_Chapter_Free_Size(rbc_handle)
+        || !RB_Write_Reserve(&(rbc_handle->base_handle), total, &region))
+    {
+        RBC_STATS_ADD(rbc_handle, write_rejected, 1);
+        return RING_BUFFER_CHAPTER_ERROR ;
+    }
+    RBC_Copy_Vector(&region, vector, vector_Number);
+    RB_Write_Commit(&(rbc_handle->base_handle), total);
+    rbc_handle->tail_chapter_length += total ;
+    return RBC_Ending_Chapter(rbc_handle);
+}
+
 /**
  * \brief 分段结尾，将暂存的字节计数保存为一条分段数据
  * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
@@ -83,15 +284,11 @@ uint8_t RBC_Ending_Chapter(ring_buffer_chapter *rbc_handle)
     //如果尾分段有暂存但未结尾的数据
     if(rbc_handle->tail_chapter_length)
     {
-        //将当前尾分段暂存字节计数存入分段环中
-        RB_Write_String(&(rbc_handle->chapter_handle), (uint8_t *)&rbc_handle->tail_chapter_length, 4);
-        //如果当前储存的是分段环的首条分段记录，则当前头分段可读字节数等于当前尾分段暂存字节计数
-        if(rbc_handle->init_flag)
-        {
-            RB_Read_String(&(rbc_handle->chapter_handle), (uint8_t *)&rbc_handle->head_chapter_length, 4);
-            rbc_handle->init_flag = 0 ;
-        }
+        //将当前数据环尾指针对应的绝对偏移作为分段结束位置存入分段环中
+        uint32_t end = rbc_handle->head_offset + RB_Get_Length(&(rbc_handle->base_handle));
+        RB_Write_String(&(rbc_handle->chapter_handle), (uint8_t *)&end, 4);
         rbc_handle->tail_chapter_length = 0 ;//当前尾分段暂存字节计数归零
+        RBC_STATS_ADD(rbc_handle, chapters_ended, 1);
         return RING_BUFFER_CHAPTER_SUCCESS ;
     }
     return RING_BUFFER_CHAPTER_ERROR ;
@@ -107,18 +304,15 @@ uint8_t RBC_Ending_Chapter(ring_buffer_chapter *rbc_handle)
 */
 uint8_t RBC_Read_Byte(ring_buffer_chapter *rbc_handle, uint8_t *output_addr)
 {
-    if(rbc_handle->head_chapter_length)
+    if(RBC_Get_Chapter_Number(rbc_handle))
     {
         RB_Read_Byte(&(rbc_handle->base_handle), output_addr);  //读取一个字节
-        rbc_handle->head_chapter_length -- ;
-        //如果当前头分段可读字节数为空
-        if(!rbc_handle->head_chapter_length)
+        rbc_handle->head_offset ++ ;
+        //如果头分段已经读完，释放对应的分段记录
+        if(rbc_handle->head_offset == RBC_Get_Chapter_End(rbc_handle, 0))
         {
-            //如果还有储存的分段记录,则读取到可读字节数变量中
-            if(RBC_Get_Chapter_Number(rbc_handle))
-                RB_Read_String(&(rbc_handle->chapter_handle), (uint8_t *)&rbc_handle->head_chapter_length, 4);
-            //如果所有分段记录都已读取，重新置位初始化完成标志位(恢复到初始化后的状态)
-            else rbc_handle->init_flag = 1 ;
+            RB_Delete(&(rbc_handle->chapter_handle), 4);
+            RBC_STATS_ADD(rbc_handle, chapters_read, 1);
         }
         return RING_BUFFER_CHAPTER_SUCCESS ;
     }
@@ -136,22 +330,168 @@ uint8_t RBC_Read_Byte(ring_buffer_chapter *rbc_handle, uint8_t *output_addr)
 */
 uint8_t RBC_Read_Chapter(ring_buffer_chapter *rbc_handle, uint8_t *output_addr, uint32_t *output_Length)
 {
-    if(rbc_handle->head_chapter_length)
+    if(RBC_Get_Chapter_Number(rbc_handle))
     {
-        RB_Read_String(&(rbc_handle->base_handle), output_addr, rbc_handle->head_chapter_length);  //读取整个头分段的数据
+        uint32_t Length = RBC_Get_Chapter_End(rbc_handle, 0) - rbc_handle->head_offset ;
+        RB_Read_String(&(rbc_handle->base_handle), output_addr, Length);  //读取整个头分段的数据
         if(output_Length != NULL)
-            *output_Length = rbc_handle->head_chapter_length ;
-        rbc_handle->head_chapter_length = 0 ;
-        //如果还有储存的分段记录,则读取到可读字节数变量中
-        if(RBC_Get_Chapter_Number(rbc_handle))
-            RB_Read_String(&(rbc_handle->chapter_handle), (uint8_t *)&rbc_handle->head_chapter_length, 4);
-        //如果所有分段记录都已读取，重新置位初始化完成标志位(恢复到初始化后的状态)
-        else rbc_handle->init_flag = 1 ;
+            *output_Length = Length ;
+        rbc_handle->head_offset += Length ;
+        RB_Delete(&(rbc_handle->chapter_handle), 4);//释放头分段的分段记录
+        RBC_STATS_ADD(rbc_handle, chapters_read, 1);
         return RING_BUFFER_CHAPTER_SUCCESS ;
     }
     return RING_BUFFER_CHAPTER_ERROR ;
 }
 
+/**
+ * \brief 获取头分段数据所在的区域，不拷贝数据
+ * \param[in] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[out] region: 头分段数据区域的描述，跨越数组末尾时分为a、b两段
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 获取成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 获取失败，没有可读的分段
+ * \note 处理完成后调用 RBC_Delete(rbc_handle, 1) 释放头分段
+*/
+uint8_t RBC_Peek_Chapter(ring_buffer_chapter *rbc_handle, ring_buffer_region *region)
+{
+    if(!RBC_Get_Chapter_Number(rbc_handle))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    if(!RB_Read_Peek(&(rbc_handle->base_handle), RBC_Get_head_Chapter_length(rbc_handle), region))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 批量获取多个分段的数据描述，不拷贝也不释放分段
+ * \param[in] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[out] vector: 分段数据描述数组，至少能容纳 max_Number 条
+ * \param[in] max_Number: 最多获取的分段数量
+ * \param[in] max_Length: 获取的分段数据总长度上限
+ * \param[in] arena_addr: 暂存区基地址，跨越数组末尾的分段会被拷贝到这里，可为NULL
+ * \param[in] arena_size: 暂存区空间大小
+ * \param[out] output_Number: 实际获取的分段数量
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 获取成功，至少获取了一个分段
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 获取失败，没有可获取的分段
+ * \note 连续储存的分段直接指向缓冲区数组内部；遇到超出长度上限或暂存区放不下的分段时停止，
+ *       处理完成后调用 RBC_Delete(rbc_handle, *output_Number) 一次释放全部分段
+*/
+uint8_t RBC_Peek_Chapters(ring_buffer_chapter *rbc_handle, ring_buffer_vector *vector, uint32_t max_Number,\
+                          uint32_t max_Length, uint8_t *arena_addr, uint32_t arena_size, uint32_t *output_Number)
+{
+    uint32_t number = RBC_Get_Chapter_Number(rbc_handle);
+    if(number > max_Number)
+        number = max_Number ;
+    ring_buffer_region region ;
+    //获取数据环中全部已储存数据的区域，各分段按相对头指针的偏移在其中定位
+    RB_Read_Peek(&(rbc_handle->base_handle), RB_Get_Length(&(rbc_handle->base_handle)), &region);
+    uint32_t start = 0, arena_used = 0, count = 0 ;
+    for(; count < number; count++)
+    {
+        uint32_t end = RBC_Get_Chapter_End(rbc_handle, count) - rbc_handle->head_offset ;
+        uint32_t Length = end - start ;
+        if(Length > max_Length)
+            break ;
+        if(end <= region.Length_a)//分段位于a段
+            vector[count].addr = region.addr_a + start ;
+        else if(start >= region.Length_a)//分段位于b段
+            vector[count].addr = region.addr_b + (start - region.Length_a) ;
+        else//分段跨越数组末尾，拷贝到暂存区
+        {
+            if(arena_addr == NULL || Length > arena_size - arena_used)
+                break ;
+            uint32_t size_a = region.Length_a - start ;
+            memcpy(arena_addr + arena_used, region.addr_a + start, size_a);
+            memcpy(arena_addr + arena_used + size_a, region.addr_b, Length - size_a);
+            vector[count].addr = arena_addr + arena_used ;
+            arena_used += Length ;
+        }
+        vector[count].Length = Length ;
+        max_Length -= Length ;
+        start = end ;
+    }
+    *output_Number = count ;
+    return count ? RING_BUFFER_CHAPTER_SUCCESS : RING_BUFFER_CHAPTER_ERROR ;
+}
+
+/**
+ * \brief 批量读取多个分段，数据依次拷贝到暂存区，全部读取后一次释放
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[out] vector: 分段数据描述数组，至少能容纳 max_Number 条，描述指向暂存区
+ * \param[in] max_Number: 最多读取的分段数量
+ * \param[in] max_Length: 读取的分段数据总长度上限
+ * \param[out] arena_addr: 暂存区基地址
+ * \param[in] arena_size: 暂存区空间大小
+ * \param[out] output_Number: 实际读取的分段数量
+ * \return 返回读取结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 读取成功，至少读取了一个分段
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 读取失败，没有可读取的分段
+*/
+uint8_t RBC_Read_Chapters(ring_buffer_chapter *rbc_handle, ring_buffer_vector *vector, uint32_t max_Number,\
+                          uint32_t max_Length, uint8_t *arena_addr, uint32_t arena_size, uint32_t *output_Number)
+{
+    uint32_t number = RBC_Get_Chapter_Number(rbc_handle);
+    if(number > max_Number)
+        number = max_Number ;
+    if(max_Length > arena_size)
+        max_Length = arena_size ;
+    uint32_t start = 0, count = 0 ;
+    for(; count < number; count++)
+    {
+        uint32_t end = RBC_Get_Chapter_End(rbc_handle, count) - rbc_handle->head_offset ;
+        if(end > max_Length)
+            break ;
+        vector[count].addr = arena_addr + start ;
+        vector[count].Length = end - start ;
+        start = end ;
+    }
+    *output_Number = count ;
+    if(!count)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //所有分段在数据环中首尾相连，一次拷贝出全部数据，再一次释放全部分段
+    RB_Read_String(&(rbc_handle->base_handle), arena_addr, start);
+    RB_Delete(&(rbc_handle->chapter_handle), count * 4);
+    rbc_handle->head_offset += start ;
+    RBC_STATS_ADD(rbc_handle, chapters_read, count);
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 从头分段开始释放指定字节数的已处理数据，可跨越多个分段，读完的分段记录一并释放
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] consume_Length: 需要释放的字节数，不能超过已结尾分段的数据总量
+ * \param[out] output_Number: 完整释放的分段数量，可为NULL
+ * \return 返回释放结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 释放成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 释放失败，已结尾分段的数据量不足
+ * \note 最后一个分段未释放完时，剩余数据保留为头分段
+*/
+uint8_t RBC_Read_Consume(ring_buffer_chapter *rbc_handle, uint32_t consume_Length, uint32_t *output_Number)
+{
+    uint32_t number = RBC_Get_Chapter_Number(rbc_handle);
+    if(consume_Length > (number ? RBC_Get_Chapter_End(rbc_handle, number - 1) - rbc_handle->head_offset : 0))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //各分段结束偏移单调递增，二分查找第一个结束位置超过释放长度的分段，其之前的分段均已读完
+    uint32_t low = 0 ;
+    uint32_t high = number ;
+    while(low < high)
+    {
+        uint32_t middle = low + (high - low) / 2 ;
+        if(RBC_Get_Chapter_End(rbc_handle, middle) - rbc_handle->head_offset <= consume_Length)
+            low = middle + 1 ;
+        else
+            high = middle ;
+    }
+    RB_Delete(&(rbc_handle->base_handle), consume_Length);
+    RB_Delete(&(rbc_handle->chapter_handle), low * 4);
+    rbc_handle->head_offset += consume_Length ;
+    RBC_STATS_ADD(rbc_handle, chapters_read, low);
+    if(output_Number != NULL)
+        *output_Number = low ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
 /**
  * \brief 从头分段开始删除指定数量的分段
  * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
@@ -165,29 +505,96 @@ uint8_t RBC_Delete(ring_buffer_chapter *rbc_handle, uint32_t chapter_number)
     //检查已存分段数量是否满足参数
     if(RBC_Get_Chapter_Number(rbc_handle) >= chapter_number && chapter_number)
     {
-        uint32_t num = rbc_handle->head_chapter_length;
-        //从分段环读取分段的长度进行累加
-        for(uint32_t i=0; i<chapter_number - 1; i++)
-        {
-            uint32_t buffer32 = 0 ;
-            //从分段环中获取分段的长度进行累加，同时实现了分段环的空间释放
-            RB_Read_String(&(rbc_handle->chapter_handle), (uint8_t *)&buffer32, 4);
-            num += buffer32 ;
-        }
-        //从数据环删除指定长度的数据
-        RB_Delete(&(rbc_handle->base_handle), num);
-        rbc_handle->head_chapter_length = 0 ;
-        //如果还有储存的分段记录,则读取到头分段可读字节数变量中
-        if(RBC_Get_Chapter_Number(rbc_handle))
-            RB_Read_String(&(rbc_handle->chapter_handle), (uint8_t *)&rbc_handle->head_chapter_length, 4);
-        //如果所有分段记录都已读取，重新置位初始化完成标志位(恢复到初始化后的状态)
-        else
-            rbc_handle->init_flag = 1 ;
+        //第 chapter_number 个分段的结束偏移即为删除后新的头指针偏移
+        uint32_t end = RBC_Get_Chapter_End(rbc_handle, chapter_number - 1);
+        //从数据环删除指定长度的数据，从分段环删除对应的分段记录
+        RB_Delete(&(rbc_handle->base_handle), end - rbc_handle->head_offset);
+        RB_Delete(&(rbc_handle->chapter_handle), chapter_number * 4);
+        rbc_handle->head_offset = end ;
+        RBC_STATS_ADD(rbc_handle, chapters_deleted, chapter_number);
         return RING_BUFFER_CHAPTER_SUCCESS ;
     }
     else return RING_BUFFER_CHAPTER_ERROR ;
 }
 
+/**
+ * \brief 获取指定分段相对数据环头指针的字节范围
+ * \param[in] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] chapter_index: 分段序号，头分段为0
+ * \param[out] output_Start: 分段起始位置相对数据环头指针的偏移，可为NULL
+ * \param[out] output_Length: 分段的长度，可为NULL
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 获取成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 获取失败，分段不存在
+ * \note 可配合 RB_Read_Peek(&rbc_handle->base_handle, ...) 直接访问该分段的数据
+*/
+uint8_t RBC_Get_Chapter_Range(ring_buffer_chapter *rbc_handle, uint32_t chapter_index,\
+                              uint32_t *output_Start, uint32_t *output_Length)
+{
+    if(chapter_index >= RBC_Get_Chapter_Number(rbc_handle))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //前一个分段的结束位置即为该分段的起始位置
+    uint32_t start = chapter_index ? RBC_Get_Chapter_End(rbc_handle, chapter_index - 1) : rbc_handle->head_offset ;
+    uint32_t end = RBC_Get_Chapter_End(rbc_handle, chapter_index);
+    if(output_Start != NULL)
+        *output_Start = start - rbc_handle->head_offset ;
+    if(output_Length != NULL)
+        *output_Length = end - start ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+#ifdef RING_BUFFER_STATS
+/**
+ * \brief 挂接分段运行统计数据并清零(需定义 RING_BUFFER_STATS 编译)
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] stats: 外部定义的统计数据，生命周期须覆盖缓冲区的使用期，传入NULL时停止统计
+ * \return 返回挂接结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 挂接成功
+ * \note 字节数、高水位与直方图需另外对 base_handle 调用 RB_Set_Stats 挂接
+*/
+uint8_t RBC_Set_Stats(ring_buffer_chapter *rbc_handle, ring_buffer_chapter_stats *stats)
+{
+    if(stats != NULL)
+        memset(stats, 0, sizeof(ring_buffer_chapter_stats));
+    rbc_handle->stats = stats ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 获取分段运行统计(需定义 RING_BUFFER_STATS 编译)
+ * \param[in] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[out] output_stats: 统计数据保存地址
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 获取成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 获取失败，未挂接统计数据
+ * \note 字节数、高水位与直方图可对 base_handle 调用 RB_Get_Stats 获取
+*/
+uint8_t RBC_Get_Stats(ring_buffer_chapter *rbc_handle, ring_buffer_chapter_stats *output_stats)
+{
+    if(rbc_handle->stats == NULL)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    *output_stats = *(rbc_handle->stats) ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 清零分段运行统计，同时清零数据环与分段环已挂接的统计(需定义 RING_BUFFER_STATS 编译)
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \return 返回清零结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 清零成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 清零失败，未挂接分段统计数据
+*/
+uint8_t RBC_Reset_Stats(ring_buffer_chapter *rbc_handle)
+{
+    RB_Reset_Stats(&(rbc_handle->base_handle));
+    RB_Reset_Stats(&(rbc_handle->chapter_handle));
+    if(rbc_handle->stats == NULL)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    memset(rbc_handle->stats, 0, sizeof(ring_buffer_chapter_stats));
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+#endif
+
 /**
  * \brief 获取当前头分段的可读长度
  * \param[in] rbc_handle: 分段版环形缓冲区结构体句柄
@@ -195,7 +602,9 @@ uint8_t RBC_Delete(ring_buffer_chapter *rbc_handle, uint32_t chapter_number)
 */
 uint32_t RBC_Get_head_Chapter_length(ring_buffer_chapter *rbc_handle)
 {
-    return rbc_handle->head_chapter_length ;
+    if(!RBC_Get_Chapter_Number(rbc_handle))
+        return 0 ;
+    return RBC_Get_Chapter_End(rbc_handle, 0) - rbc_handle->head_offset ;
 }
 
 /**
@@ -205,11 +614,7 @@ uint32_t RBC_Get_head_Chapter_length(ring_buffer_chapter *rbc_handle)
 */
 uint32_t RBC_Get_Chapter_Number(ring_buffer_chapter *rbc_handle)
 {
-    uint32_t number = RB_Get_Length(&(rbc_handle->chapter_handle))/4 ;
-    if(rbc_handle->head_chapter_length)
-        if(!number) return 1 ;
-        else return number + 1 ;
-    return number ;
+    return RB_Get_Length(&(rbc_handle->chapter_handle))/4 ;
 }
 
 /**
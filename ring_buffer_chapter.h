@@ -11,32 +11,83 @@
 
 #include "ring_buffer.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 //返回值定义
 #define RING_BUFFER_CHAPTER_SUCCESS     0x01
 #define RING_BUFFER_CHAPTER_ERROR       0x00
 
+//工作模式标志位定义
+#define RING_BUFFER_CHAPTER_FLAG_OVERWRITE  0x01    //覆盖模式，空间不足时丢弃最旧的完整分段
+
+//分段运行统计，与 ring_buffer_stats 相同由调用者定义并通过 RBC_Set_Stats 挂接，句柄布局与是否定义 RING_BUFFER_STATS 无关
+//数据环与分段环各自的字节统计可对 base_handle、chapter_handle 调用 RB_Set_Stats 挂接
+struct ring_buffer_chapter_stats ;
+#ifdef RING_BUFFER_STATS
+typedef struct ring_buffer_chapter_stats
+{
+    uint64_t chapters_ended ;       //完成结尾的分段数量
+    uint64_t chapters_read ;        //被读出的分段数量
+    uint64_t chapters_deleted ;     //被删除(含覆盖模式丢弃)的分段数量
+    uint64_t write_rejected ;       //空间不足被拒绝的写入次数
+}ring_buffer_chapter_stats;
+#endif
+
 //环形缓冲分段结构体
+//绝对偏移为自初始化以来数据环累计写入的字节位置(按 uint32_t 自然溢出)，分段环中按顺序记录每个分段结束处的绝对偏移，
+//任意第k个分段的字节范围与连续删除任意数量的分段均可在常数时间内完成
 typedef struct
 {
     ring_buffer base_handle ;       //数据储存环形缓冲区句柄
-    ring_buffer chapter_handle ;    //分段记录环形缓冲区句柄
-    uint32_t head_chapter_length;   //当前头分段可读字节数
+    ring_buffer chapter_handle ;    //分段记录环形缓冲区句柄，每条记录为4字节的分段结束绝对偏移
+    uint32_t head_offset;           //数据环头指针对应的绝对偏移
     uint32_t tail_chapter_length;   //当前尾分段暂存字节计数
-    uint8_t init_flag;              //初始化完成标志位
+    uint8_t flags;                  //工作模式标志位
+    struct ring_buffer_chapter_stats *stats ;   //分段运行统计，初始化后为NULL，由 RBC_Set_Stats 挂接
 }ring_buffer_chapter;
 
+//分段数据描述，批量读取时每个分段对应一条
+typedef struct
+{
+    uint8_t *addr ;                 //分段数据起始地址
+    uint32_t Length ;               //分段数据长度
+}ring_buffer_vector;
+
 uint8_t RBC_Init(ring_buffer_chapter *rbc_handle,\
                 uint8_t *base_buffer_addr, uint32_t base_buffer_size,\
                 uint32_t *chapter_buffer_addr, uint32_t chapter_buffer_size);                               //初始化带分段功能的环形缓冲区
+uint8_t RBC_Set_Overwrite(ring_buffer_chapter *rbc_handle, uint8_t enable);                                 //开启或关闭覆盖模式
 uint8_t RBC_Write_Byte(ring_buffer_chapter *rbc_handle, uint8_t data);                                      //向尾分段里写一个字节
 uint8_t RBC_Write_String(ring_buffer_chapter *rbc_handle, uint8_t *input_addr, uint32_t write_Length);      //向尾分段里写指定长度数据
+uint8_t RBC_Write_Reserve(ring_buffer_chapter *rbc_handle, uint32_t reserve_Length, ring_buffer_region *region); //预留尾分段之后指定长度的可写区域
+uint8_t RBC_Write_Commit(ring_buffer_chapter *rbc_handle, uint32_t commit_Length);                           //提交已直接写入预留区域的尾分段数据
+uint8_t RBC_Write_Chapter_Vector(ring_buffer_chapter *rbc_handle, const ring_buffer_vector *vector, uint32_t vector_Number); //将多段数据写入尾分段并结尾，全部成功或不做任何修改
 uint8_t RBC_Ending_Chapter(ring_buffer_chapter *rbc_handle);                                                //分段结尾，完成一次分段记录
 uint8_t RBC_Read_Byte(ring_buffer_chapter *rbc_handle, uint8_t *output_addr);                               //从头分段读取一个字节
 uint8_t RBC_Read_Chapter(ring_buffer_chapter *rbc_handle, uint8_t *output_addr, uint32_t *output_Length);   //读取整个头分段
+uint8_t RBC_Peek_Chapter(ring_buffer_chapter *rbc_handle, ring_buffer_region *region);                      //获取头分段数据所在区域(不拷贝)
+uint8_t RBC_Peek_Chapters(ring_buffer_chapter *rbc_handle, ring_buffer_vector *vector, uint32_t max_Number,\
+                          uint32_t max_Length, uint8_t *arena_addr, uint32_t arena_size, uint32_t *output_Number);  //批量获取多个分段的数据描述(不释放)
+uint8_t RBC_Read_Chapters(ring_buffer_chapter *rbc_handle, ring_buffer_vector *vector, uint32_t max_Number,\
+                          uint32_t max_Length, uint8_t *arena_addr, uint32_t arena_size, uint32_t *output_Number);  //批量读取多个分段到暂存区并一次释放
+uint8_t RBC_Read_Consume(ring_buffer_chapter *rbc_handle, uint32_t consume_Length, uint32_t *output_Number);  //从头分段开始释放指定字节数，输出读完的分段数量
 uint8_t RBC_Delete(ring_buffer_chapter *rbc_handle, uint32_t Chapter_Number);                               //从头分段开始删除指定数量的分段
+uint8_t RBC_Get_Chapter_Range(ring_buffer_chapter *rbc_handle, uint32_t chapter_index,\
+                              uint32_t *output_Start, uint32_t *output_Length);                             //获取第 chapter_index 个分段相对头指针的字节范围
+#ifdef RING_BUFFER_STATS
+uint8_t RBC_Set_Stats(ring_buffer_chapter *rbc_handle, ring_buffer_chapter_stats *stats);                 //挂接并清零分段运行统计，传入NULL时停止统计
+uint8_t RBC_Get_Stats(ring_buffer_chapter *rbc_handle, ring_buffer_chapter_stats *output_stats);          //获取分段运行统计
+uint8_t RBC_Reset_Stats(ring_buffer_chapter *rbc_handle);                                                   //清零分段统计及两个内部环的统计
+#endif
 uint32_t RBC_Get_head_Chapter_length(ring_buffer_chapter *rbc_handle);                                      //获取当前头分段的长度
 uint32_t RBC_Get_Chapter_Number(ring_buffer_chapter *rbc_handle);                                           //获取当前已记录的分段数量
 uint32_t RBC_Get_Base_Free_Size(ring_buffer_chapter *rbc_handle);                                           //获取数据环剩余可用空间
 uint32_t RBC_Get_Chapter_Free_Size(ring_buffer_chapter *rbc_handle);                                        //获取剩余可记录的分段数量
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,24 @@
+/**
+ * \file ring_buffer_chapter_internal.h
+ * \brief 分段环形缓冲各实现文件共用的内部函数声明，只由库内的 .c 文件包含，不属于公开接口
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_CHAPTER_INTERNAL_H_
+#define _RING_BUFFER_CHAPTER_INTERNAL_H_
+
+#include "ring_buffer_chapter.h"
+
+//分段统计计数，未定义 RING_BUFFER_STATS 时不产生任何代码
+#ifdef RING_BUFFER_STATS
+#define RBC_STATS_ADD(rbc_handle, field, number)    do{ if((rbc_handle)->stats) (rbc_handle)->stats->field += (number); }while(0)
+#else
+#define RBC_STATS_ADD(rbc_handle, field, number)    ((void)0)
+#endif
+
+void RBC_Copy_Vector(const ring_buffer_region *region, const ring_buffer_vector *vector, uint32_t vector_Number);    //将多段数据按顺序拼接拷贝进预留区域
+uint8_t RBC_Make_Room(ring_buffer_chapter *rbc_handle, uint32_t write_Length, uint32_t chapter_Number);    //(覆盖模式)丢弃最旧的分段，为写入腾出数据与分段记录空间
+
+#endif//#ifndef _RING_BUFFER_CHAPTER_INTERNAL_H_
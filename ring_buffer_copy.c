@@ -0,0 +1,134 @@
+/**
+ * \file ring_buffer_copy.c
+ * \brief 大块数据拷贝内核的实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "ring_buffer_copy.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define RB_COPY_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * 小块数据直接使用 memcpy，数据留在缓存中供对端马上读取；
+ * 大块数据写入缓冲区时使用非临时存储，数据绕过缓存直接写入内存(深缓冲的数据要很久之后才被读出，
+ * 留在缓存中只会挤出热数据)，同时省去写分配时读取目标缓存行的内存流量，并提前预取源数据；
+ * x86 上默认使用 SSE2 每次存储16字节，首次流式拷贝时检测到 AVX2 则之后每次存储32字节，其余平台总是使用 memcpy；
+ * 从缓冲区读出时目标通常是调用者马上要使用的数组，仍使用 memcpy
+*/
+
+static _Atomic uint32_t rb_copy_threshold = RB_COPY_THRESHOLD ;
+
+#ifdef RB_COPY_X86
+//Length 不小于 RB_COPY_MIN_LENGTH，先用 memcpy 对齐目标地址，再按64字节一组流式存储，剩余部分用 memcpy
+static void RB_Copy_Stream_SSE2(uint8_t *destination, const uint8_t *source, uint32_t Length)
+{
+    uint32_t head = (uint32_t)(-(uintptr_t)destination & 15);
+    memcpy(destination, source, head);
+    destination += head ;
+    source += head ;
+    Length -= head ;
+    for(; Length >= 64; Length -= 64, destination += 64, source += 64)
+    {
+        _mm_prefetch((const char *)(source + RB_COPY_PREFETCH_DISTANCE), _MM_HINT_T0);
+        __m128i a = _mm_loadu_si128((const __m128i *)(source));
+        __m128i b = _mm_loadu_si128((const __m128i *)(source + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(source + 32));
+        __m128i d = _mm_loadu_si128((const __m128i *)(source + 48));
+        _mm_stream_si128((__m128i *)(destination), a);
+        _mm_stream_si128((__m128i *)(destination + 16), b);
+        _mm_stream_si128((__m128i *)(destination + 32), c);
+        _mm_stream_si128((__m128i *)(destination + 48), d);
+    }
+    //非临时存储是弱序的，返回前必须保证其对其他核心可见，之后的指针发布才有意义
+    _mm_sfence();
+    memcpy(destination, source, Length);
+}
+
+//按128字节一组流式存储，其余同 RB_Copy_Stream_SSE2
+__attribute__((target("avx2")))
+static void RB_Copy_Stream_AVX2(uint8_t *destination, const uint8_t *source, uint32_t Length)
+{
+    uint32_t head = (uint32_t)(-(uintptr_t)destination & 31);
+    memcpy(destination, source, head);
+    destination += head ;
+    source += head ;
+    Length -= head ;
+    for(; Length >= 128; Length -= 128, destination += 128, source += 128)
+    {
+        _mm_prefetch((const char *)(source + RB_COPY_PREFETCH_DISTANCE), _MM_HINT_T0);
+        _mm_prefetch((const char *)(source + RB_COPY_PREFETCH_DISTANCE + 64), _MM_HINT_T0);
+        __m256i a = _mm256_loadu_si256((const __m256i *)(source));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(source + 32));
+        __m256i c = _mm256_loadu_si256((const __m256i *)(source + 64));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(source + 96));
+        _mm256_stream_si256((__m256i *)(destination), a);
+        _mm256_stream_si256((__m256i *)(destination + 32), b);
+        _mm256_stream_si256((__m256i *)(destination + 64), c);
+        _mm256_stream_si256((__m256i *)(destination + 96), d);
+    }
+    _mm_sfence();
+    memcpy(destination, source, Length);
+}
+
+typedef void (*rb_copy_kernel)(uint8_t *destination, const uint8_t *source, uint32_t Length);
+static void RB_Copy_Stream_Select(uint8_t *destination, const uint8_t *source, uint32_t Length);
+
+//流式拷贝内核，首次调用时由 RB_Copy_Stream_Select 检测一次 CPU 特性后替换，之后直接调用
+static _Atomic(rb_copy_kernel) rb_copy_stream = RB_Copy_Stream_Select ;
+
+static void RB_Copy_Stream_Select(uint8_t *destination, const uint8_t *source, uint32_t Length)
+{
+    rb_copy_kernel kernel = __builtin_cpu_supports("avx2") ? RB_Copy_Stream_AVX2 : RB_Copy_Stream_SSE2 ;
+    //多个线程同时首次调用时写入的是同一个值
+    atomic_store_explicit(&rb_copy_stream, kernel, memory_order_relaxed);
+    kernel(destination, source, Length);
+}
+#endif
+
+/**
+ * \brief 拷贝数据到缓冲区，长度达到阈值时使用非临时存储并预取源数据，否则使用 memcpy
+ * \param[out] destination: 缓冲区中的目标地址
+ * \param[in] source: 源地址，与目标区域不能重叠
+ * \param[in] Length: 拷贝的字节数
+ * \note 跨越数组末尾的传输由调用者拆成两次调用，每段分别与阈值比较；
+ *       使用非临时存储时函数返回前已执行存储屏障，调用者随后发布写指针的顺序保证不变
+*/
+void RB_Copy_In(void *destination, const void *source, uint32_t Length)
+{
+#ifdef RB_COPY_X86
+    if(Length >= RB_COPY_MIN_LENGTH && Length >= atomic_load_explicit(&rb_copy_threshold, memory_order_relaxed))
+    {
+        atomic_load_explicit(&rb_copy_stream, memory_order_relaxed)((uint8_t *)destination, (const uint8_t *)source, Length);
+        return ;
+    }
+#endif
+    memcpy(destination, source, Length);
+}
+
+/**
+ * \brief 设置使用非临时存储的长度阈值，所有缓冲区共用
+ * \param[in] threshold: 长度阈值(字节)，小于 RB_COPY_MIN_LENGTH 时按 RB_COPY_MIN_LENGTH 处理，
+ *                       设为 UINT32_MAX 时(除恰好 UINT32_MAX 字节的拷贝外)总是使用 memcpy
+ * \note 数据写入后很快被读出时(浅缓冲，对端读取时数据还在缓存中)，应调高阈值
+*/
+void RB_Set_Copy_Threshold(uint32_t threshold)
+{
+    atomic_store_explicit(&rb_copy_threshold, threshold, memory_order_relaxed);
+}
+
+/**
+ * \brief 获取当前的长度阈值
+ * \return 返回长度阈值(字节)
+*/
+uint32_t RB_Get_Copy_Threshold(void)
+{
+    return atomic_load_explicit(&rb_copy_threshold, memory_order_relaxed);
+}
@@ -0,0 +1,47 @@
+/**
+ * \file ring_buffer_copy.h
+ * \brief 大块数据拷贝内核相关定义与声明
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_COPY_H_
+#define _RING_BUFFER_COPY_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//默认阈值，单次写入缓冲区的长度达到此值时使用非临时存储
+#ifndef RB_COPY_THRESHOLD
+#define RB_COPY_THRESHOLD           (64 * 1024)
+#endif
+
+//源数据软件预取距离(字节)
+#ifndef RB_COPY_PREFETCH_DISTANCE
+#define RB_COPY_PREFETCH_DISTANCE   512
+#endif
+
+//使用非临时存储的最小长度，阈值小于此值时按此值处理
+#define RB_COPY_MIN_LENGTH          256
+
+//写入缓冲区使用的拷贝宏，定义 RING_BUFFER_USE_COPY_KERNEL 编译时使用 RB_Copy_In，否则直接使用 memcpy
+#ifdef RING_BUFFER_USE_COPY_KERNEL
+#define RB_COPY_IN(destination, source, Length)     RB_Copy_In((destination), (source), (Length))
+#else
+#define RB_COPY_IN(destination, source, Length)     memcpy((destination), (source), (Length))
+#endif
+
+void RB_Copy_In(void *destination, const void *source, uint32_t Length);   //拷贝数据到缓冲区，达到阈值时使用非临时存储
+void RB_Set_Copy_Threshold(uint32_t threshold);                             //设置使用非临时存储的长度阈值
+uint32_t RB_Get_Copy_Threshold(void);                                       //获取当前的长度阈值
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_COPY_H_
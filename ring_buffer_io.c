@@ -0,0 +1,112 @@
+/**
+ * \file ring_buffer_io.c
+ * \brief 环形缓冲与文件描述符之间的 readv/writev 收发实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/uio.h>
+#include "ring_buffer_io.h"
+
+//将缓冲区区域描述转换为 iovec 数组，返回有效的 iovec 数量
+static int RB_Region_To_Iovec(ring_buffer_region *region, struct iovec *iov)
+{
+    iov[0].iov_base = region->addr_a ;
+    iov[0].iov_len = region->Length_a ;
+    if(!region->Length_b)
+        return 1 ;
+    iov[1].iov_base = region->addr_b ;
+    iov[1].iov_len = region->Length_b ;
+    return 2 ;
+}
+
+/**
+ * \brief 从文件描述符读取数据，直接填充缓冲区的全部可用空间，只调用一次 readv
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] fd: 可读的文件描述符(套接字、串口等)
+ * \param[out] output_Length: 实际读取的字节数，可为NULL，为0时表示对端已关闭
+ * \return 返回读取结果
+ *      \arg RING_BUFFER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_ERROR: 读取失败，缓冲区已满或 readv 出错(错误原因见 errno)
+*/
+uint8_t RB_Read_Fd(ring_buffer *rb_handle, int fd, uint32_t *output_Length)
+{
+    ring_buffer_region region ;
+    struct iovec iov[2];
+    uint32_t free_size = RB_Get_FreeSize(rb_handle);
+    if(!free_size)
+        return RING_BUFFER_ERROR ;
+    RB_Write_Reserve(rb_handle, free_size, &region);
+    ssize_t result = readv(fd, iov, RB_Region_To_Iovec(&region, iov));
+    if(result < 0)
+        return RING_BUFFER_ERROR ;
+    RB_Write_Commit(rb_handle, (uint32_t)result);
+    if(output_Length != NULL)
+        *output_Length = (uint32_t)result ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 将缓冲区已储存的数据直接写入文件描述符，只调用一次 writev，已写出的数据从缓冲区释放
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] fd: 可写的文件描述符(套接字、串口等)
+ * \param[out] output_Length: 实际写出的字节数，可为NULL
+ * \return 返回写出结果
+ *      \arg RING_BUFFER_SUCCESS: 写出成功，可能只写出了部分数据
+ *      \arg RING_BUFFER_ERROR: 写出失败，缓冲区为空或 writev 出错(错误原因见 errno)
+*/
+uint8_t RB_Write_Fd(ring_buffer *rb_handle, int fd, uint32_t *output_Length)
+{
+    ring_buffer_region region ;
+    struct iovec iov[2];
+    uint32_t Length = RB_Get_Length(rb_handle);
+    if(!Length)
+        return RING_BUFFER_ERROR ;
+    RB_Read_Peek(rb_handle, Length, &region);
+    ssize_t result = writev(fd, iov, RB_Region_To_Iovec(&region, iov));
+    if(result < 0)
+        return RING_BUFFER_ERROR ;
+    RB_Read_Consume(rb_handle, (uint32_t)result);
+    if(output_Length != NULL)
+        *output_Length = (uint32_t)result ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 将头部若干个完整的分段直接写入文件描述符，只调用一次 writev，尾分段暂存的数据不会被写出
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] fd: 可写的文件描述符(套接字、串口等)
+ * \param[in] max_Number: 最多写出的分段数量
+ * \param[out] output_Length: 实际写出的字节数，可为NULL
+ * \param[out] output_Number: 完整写出的分段数量，可为NULL
+ * \return 返回写出结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 写出成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 写出失败，没有分段或 writev 出错(错误原因见 errno)
+ * \note 文件描述符只接收了部分数据时，最后一个分段剩余的数据保留为头分段，下次调用时继续写出
+*/
+uint8_t RBC_Write_Fd(ring_buffer_chapter *rbc_handle, int fd, uint32_t max_Number,\
+                     uint32_t *output_Length, uint32_t *output_Number)
+{
+    ring_buffer_region region ;
+    struct iovec iov[2];
+    uint32_t number = RBC_Get_Chapter_Number(rbc_handle);
+    if(number > max_Number)
+        number = max_Number ;
+    if(!number)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //前 number 个分段在数据环中首尾相连，最后一个分段的结束位置即为总长度
+    uint32_t start, Length ;
+    RBC_Get_Chapter_Range(rbc_handle, number - 1, &start, &Length);
+    RB_Read_Peek(&(rbc_handle->base_handle), start + Length, &region);
+    ssize_t result = writev(fd, iov, RB_Region_To_Iovec(&region, iov));
+    if(result < 0)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //写出的字节数不超过前 number 个分段的总长度，释放必然成功
+    RBC_Read_Consume(rbc_handle, (uint32_t)result, output_Number);
+    if(output_Length != NULL)
+        *output_Length = (uint32_t)result ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
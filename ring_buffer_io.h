@@ -0,0 +1,29 @@
+/**
+ * \file ring_buffer_io.h
+ * \brief 环形缓冲与文件描述符之间的 readv/writev 收发相关声明
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_IO_H_
+#define _RING_BUFFER_IO_H_
+
+#include <stdint.h>
+#include "ring_buffer.h"
+#include "ring_buffer_chapter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint8_t RB_Read_Fd(ring_buffer *rb_handle, int fd, uint32_t *output_Length);           //从文件描述符读取数据填充缓冲区可用空间
+uint8_t RB_Write_Fd(ring_buffer *rb_handle, int fd, uint32_t *output_Length);          //将缓冲区已储存的数据写入文件描述符
+uint8_t RBC_Write_Fd(ring_buffer_chapter *rbc_handle, int fd, uint32_t max_Number,\
+                     uint32_t *output_Length, uint32_t *output_Number);                //将完整的分段写入文件描述符
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_IO_H_
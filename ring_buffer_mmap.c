@@ -0,0 +1,197 @@
+/**
+ * \file ring_buffer_mmap.c
+ * \brief 环形缓冲的 Linux 内存映射分配实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "ring_buffer_mmap.h"
+
+/*
+ * 镜像映射：通过 memfd 创建一块匿名共享内存，在连续的虚拟地址上映射两次，
+ * array_addr[max_Length + i] 与 array_addr[i] 为同一物理字节，
+ * 因此从任意下标开始、长度不超过 max_Length 的区域都可以作为一段连续内存访问
+*/
+
+//分配长度为 2*size 的虚拟地址空间，前后两半映射同一块物理内存
+static uint8_t *RB_Mirror_Map(uint32_t size)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    //镜像的两半必须按页对齐
+    if(size < 2 || page_size <= 0 || size % (uint32_t)page_size)
+        return NULL ;
+    int fd = memfd_create("ring_buffer", MFD_CLOEXEC);
+    if(fd < 0)
+        return NULL ;
+    if(ftruncate(fd, size) != 0)
+    {
+        close(fd);
+        return NULL ;
+    }
+    //先保留完整的地址范围，再用 MAP_FIXED 把同一文件映射到前后两半
+    uint8_t *addr = mmap(NULL, (size_t)size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(addr == MAP_FAILED)
+    {
+        close(fd);
+        return NULL ;
+    }
+    if(mmap(addr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+       mmap(addr + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(addr, (size_t)size * 2);
+        close(fd);
+        return NULL ;
+    }
+    close(fd);//映射建立后文件描述符不再需要
+    return addr ;
+}
+
+/**
+ * \brief 分配镜像映射的数组并初始化缓冲区
+ * \param[out] rb_handle: 待初始化的缓冲区结构体句柄
+ * \param[in] buffer_size: 缓冲区数组空间，必须为系统页大小的整数倍
+ * \return 返回缓冲区初始化的结果
+ *      \arg RING_BUFFER_SUCCESS: 初始化成功
+ *      \arg RING_BUFFER_ERROR: 初始化失败
+ * \note 数组空间为2的幂时自动使用2的幂模式，不再使用时需调用 RB_Free_Mirror 释放
+*/
+uint8_t RB_Init_Mirror(ring_buffer *rb_handle, uint32_t buffer_size)
+{
+    uint8_t *addr = RB_Mirror_Map(buffer_size);
+    if(addr == NULL)
+        return RING_BUFFER_ERROR ;
+    uint8_t result ;
+    if(buffer_size & (buffer_size - 1))
+        result = RB_Init(rb_handle, addr, buffer_size);
+    else
+        result = RB_Init_Pow2(rb_handle, addr, buffer_size);
+    if(!result)
+    {
+        munmap(addr, (size_t)buffer_size * 2);
+        return RING_BUFFER_ERROR ;
+    }
+    rb_handle->flags |= RING_BUFFER_FLAG_MIRROR ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 释放镜像映射的数组
+ * \param[out] rb_handle: 由 RB_Init_Mirror 初始化的缓冲区结构体句柄
+ * \return 返回释放结果
+ *      \arg RING_BUFFER_SUCCESS: 释放成功
+ *      \arg RING_BUFFER_ERROR: 释放失败，缓冲区不是镜像模式
+*/
+uint8_t RB_Free_Mirror(ring_buffer *rb_handle)
+{
+    if(!(rb_handle->flags & RING_BUFFER_FLAG_MIRROR))
+        return RING_BUFFER_ERROR ;
+    munmap(rb_handle->array_addr, (size_t)rb_handle->max_Length * 2);
+    rb_handle->array_addr = NULL ;
+    rb_handle->flags &= (uint8_t)~RING_BUFFER_FLAG_MIRROR ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 数据环使用镜像映射数组初始化分段环形缓冲区，任意完整分段均可通过 RBC_Peek_Chapter 作为一段连续内存访问
+ * \param[out] rbc_handle: 待初始化的缓冲区结构体句柄
+ * \param[in] base_buffer_size: 数据环缓冲区数组空间大小，必须为系统页大小的整数倍
+ * \param[in] chapter_buffer_addr: 分段环缓冲区数组基地址
+ * \param[in] chapter_buffer_size: 分段环缓冲区数组空间大小
+ * \return 返回缓冲区初始化的结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 初始化成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 初始化失败
+*/
+uint8_t RBC_Init_Mirror(ring_buffer_chapter *rbc_handle, uint32_t base_buffer_size,\
+                        uint32_t *chapter_buffer_addr, uint32_t chapter_buffer_size)
+{
+    uint8_t *addr = RB_Mirror_Map(base_buffer_size);
+    if(addr == NULL)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    if(!RBC_Init(rbc_handle, addr, base_buffer_size, chapter_buffer_addr, chapter_buffer_size))
+    {
+        munmap(addr, (size_t)base_buffer_size * 2);
+        return RING_BUFFER_CHAPTER_ERROR ;
+    }
+    rbc_handle->base_handle.flags |= RING_BUFFER_FLAG_MIRROR ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 释放分段环形缓冲区的镜像映射数组
+ * \param[out] rbc_handle: 由 RBC_Init_Mirror 初始化的缓冲区结构体句柄
+ * \return 返回释放结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 释放成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 释放失败，数据环不是镜像模式
+*/
+uint8_t RBC_Free_Mirror(ring_buffer_chapter *rbc_handle)
+{
+    if(!RB_Free_Mirror(&(rbc_handle->base_handle)))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+//分配长度按大页大小向上取整
+static size_t RB_Huge_Round(uint64_t size)
+{
+    return (size_t)((size + RB_HUGE_PAGE_SIZE - 1) & ~(uint64_t)(RB_HUGE_PAGE_SIZE - 1));
+}
+
+/**
+ * \brief 分配大页支持的缓冲区数组，减少大容量缓冲区的 TLB 缺失，可选预先触发缺页
+ * \param[in] size: 需要的数组空间，实际映射长度按 RB_HUGE_PAGE_SIZE 向上取整
+ * \param[in] flags: 分配选项，RB_HUGE_EXPLICIT、RB_HUGE_PREFAULT 的组合
+ * \return 返回数组基地址(按大页对齐)，失败时返回NULL
+ * \note 显式大页需要系统预留(vm.nr_hugepages)，不可用时自动退回 madvise(MADV_HUGEPAGE) 透明大页；
+ *       返回的数组可交给 RB_Init、RB_Init_Pow2 或 RB64_Init 使用
+*/
+uint8_t *RB_Alloc_Huge(uint64_t size, uint8_t flags)
+{
+    if(!size || size > (uint64_t)SIZE_MAX - RB_HUGE_PAGE_SIZE)
+        return NULL ;
+    size_t map_size = RB_Huge_Round(size);
+    uint8_t *addr = MAP_FAILED ;
+#ifdef MAP_HUGETLB
+    if(flags & RB_HUGE_EXPLICIT)
+        addr = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    if(addr == MAP_FAILED)
+    {
+        //多映射一个大页的长度，裁掉首尾多余部分得到按大页对齐的地址，透明大页才能完整覆盖数组
+        uint8_t *raw = mmap(NULL, map_size + RB_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(raw == MAP_FAILED)
+            return NULL ;
+        size_t lead = (RB_HUGE_PAGE_SIZE - ((uintptr_t)raw & (RB_HUGE_PAGE_SIZE - 1))) & (RB_HUGE_PAGE_SIZE - 1);
+        if(lead)
+            munmap(raw, lead);
+        if(RB_HUGE_PAGE_SIZE - lead)
+            munmap(raw + lead + map_size, RB_HUGE_PAGE_SIZE - lead);
+        addr = raw + lead ;
+#ifdef MADV_HUGEPAGE
+        madvise(addr, map_size, MADV_HUGEPAGE);
+#endif
+    }
+    if(flags & RB_HUGE_PREFAULT)
+    {
+        long page_size = sysconf(_SC_PAGESIZE);
+        for(size_t i = 0; i < map_size; i += (size_t)page_size)
+            ((volatile uint8_t *)addr)[i] = 0 ;
+    }
+    return addr ;
+}
+
+/**
+ * \brief 释放 RB_Alloc_Huge 分配的数组
+ * \param[in] addr: RB_Alloc_Huge 返回的数组基地址
+ * \param[in] size: 分配时传入的数组空间
+*/
+void RB_Free_Huge(uint8_t *addr, uint64_t size)
+{
+    if(addr != NULL)
+        munmap(addr, RB_Huge_Round(size));
+}
@@ -0,0 +1,38 @@
+/**
+ * \file ring_buffer_mmap.h
+ * \brief 环形缓冲的 Linux 内存映射分配相关声明
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_MMAP_H_
+#define _RING_BUFFER_MMAP_H_
+
+#include <stdint.h>
+#include "ring_buffer.h"
+#include "ring_buffer_chapter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//大页分配选项
+#define RB_HUGE_PAGE_SIZE       (2u * 1024 * 1024)  //大页大小，分配长度按此向上取整
+#define RB_HUGE_EXPLICIT        0x01                //优先使用预留的显式大页(MAP_HUGETLB)，失败时退回透明大页
+#define RB_HUGE_PREFAULT        0x02                //分配后立即逐页写入，避免首次访问时的缺页中断
+
+uint8_t RB_Init_Mirror(ring_buffer *rb_handle, uint32_t buffer_size);                                 //分配镜像映射的数组并初始化缓冲区
+uint8_t RB_Free_Mirror(ring_buffer *rb_handle);                                                       //释放镜像映射的数组
+uint8_t RBC_Init_Mirror(ring_buffer_chapter *rbc_handle, uint32_t base_buffer_size,\
+                        uint32_t *chapter_buffer_addr, uint32_t chapter_buffer_size);                 //数据环使用镜像映射数组初始化分段环形缓冲区
+uint8_t RBC_Free_Mirror(ring_buffer_chapter *rbc_handle);                                             //释放分段环形缓冲区的镜像映射数组
+
+uint8_t *RB_Alloc_Huge(uint64_t size, uint8_t flags);                                                  //分配大页支持的缓冲区数组
+void RB_Free_Huge(uint8_t *addr, uint64_t size);                                                      //释放 RB_Alloc_Huge 分配的数组
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_MMAP_H_
@@ -0,0 +1,288 @@
+/**
+ * \file ring_buffer_mpmc.c
+ * \brief 多生产者多消费者有界分段队列的实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "ring_buffer_mpmc.h"
+#include "ring_buffer_chapter_internal.h"
+
+/*
+ * 每个槽位带有一个序号(与 Vyukov 有界队列相同)：
+ * 序号等于位置 p 时槽位空闲，生产者确认连续 k 个槽位均空闲后，通过一次比较交换把领取位置推进 k；
+ * 数据写完后将首个槽位的序号置为 p+1 发布分段；消费者看到首个槽位已发布，
+ * 同样通过一次比较交换领取整个分段，处理完成后把每个槽位的序号置为 p+slot_Number，供下一轮使用
+*/
+
+//计算 Length 字节需要的槽位数量，长度为0的分段也占用一个槽位
+static uint32_t RBQ_Slot_Count(ring_buffer_mpmc *rbq_handle, uint32_t Length)
+{
+    if(!Length)
+        return 1 ;
+    return (uint32_t)(((uint64_t)Length + rbq_handle->slot_size - 1) / rbq_handle->slot_size);
+}
+
+//将从槽位位置 position 开始、长度为 Length 的数据区域描述为a、b两段
+static void RBQ_Make_Region(ring_buffer_mpmc *rbq_handle, uint32_t position, uint32_t Length, ring_buffer_region *region)
+{
+    uint32_t index = (position & rbq_handle->mask) * rbq_handle->slot_size ;
+    uint32_t size_a = rbq_handle->slot_Number * rbq_handle->slot_size - index ;
+    region->addr_a = rbq_handle->array_addr + index ;
+    if(Length > size_a)
+    {
+        region->Length_a = size_a ;
+        region->addr_b = rbq_handle->array_addr ;
+        region->Length_b = Length - size_a ;
+    }
+    else
+    {
+        region->Length_a = Length ;
+        region->addr_b = NULL ;
+        region->Length_b = 0 ;
+    }
+}
+
+/**
+ * \brief 初始化分段队列
+ * \param[out] rbq_handle: 待初始化的队列结构体句柄
+ * \param[in] slot_addr: 外部定义的槽位状态数组，元素数量为 slot_Number
+ * \param[in] slot_Number: 槽位数量，必须为2的幂
+ * \param[in] buffer_addr: 外部定义的数据数组，空间为 slot_Number * slot_size
+ * \param[in] slot_size: 每个槽位的数据字节数
+ * \return 返回队列初始化的结果
+ *      \arg RING_BUFFER_SUCCESS: 初始化成功
+ *      \arg RING_BUFFER_ERROR: 初始化失败
+ * \note 初始化须在各线程开始访问之前完成；单个分段最长为 slot_Number * slot_size 字节
+*/
+uint8_t RBQ_Init(ring_buffer_mpmc *rbq_handle, ring_buffer_mpmc_slot *slot_addr, uint32_t slot_Number,\
+                 uint8_t *buffer_addr, uint32_t slot_size)
+{
+    if(slot_Number < 2 || slot_Number > 0x80000000 || (slot_Number & (slot_Number - 1)) ||\
+       !slot_size || (uint64_t)slot_Number * slot_size > 0xFFFFFFFF)
+        return RING_BUFFER_ERROR ;
+    for(uint32_t i = 0; i < slot_Number; i++)
+    {
+        atomic_init(&slot_addr[i].sequence, i);
+        atomic_init(&slot_addr[i].Length, 0);
+        atomic_init(&slot_addr[i].Number, 0);
+    }
+    atomic_init(&rbq_handle->enqueue_position, 0);
+    atomic_init(&rbq_handle->dequeue_position, 0);
+    rbq_handle->slot_addr = slot_addr ;
+    rbq_handle->array_addr = buffer_addr ;
+    rbq_handle->slot_Number = slot_Number ;
+    rbq_handle->mask = slot_Number - 1 ;
+    rbq_handle->slot_size = slot_size ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)预留一个分段的可写区域，多个生产者可同时预留并写入互不重叠的槽位
+ * \param[in] rbq_handle: 队列结构体句柄
+ * \param[in] reserve_Length: 需要预留的字节数
+ * \param[out] region: 预留区域的描述，跨越数组末尾时分为a、b两段
+ * \param[out] ticket: 预留的槽位，提交时传回
+ * \return 返回预留结果
+ *      \arg RING_BUFFER_SUCCESS: 预留成功
+ *      \arg RING_BUFFER_ERROR: 预留失败，队列没有足够的连续空闲槽位
+ * \note 预留成功后必须调用 RBQ_Write_Commit，否则之后的分段无法被读取
+*/
+uint8_t RBQ_Write_Reserve(ring_buffer_mpmc *rbq_handle, uint32_t reserve_Length,\
+                          ring_buffer_region *region, ring_buffer_mpmc_ticket *ticket)
+{
+    uint32_t Number = RBQ_Slot_Count(rbq_handle, reserve_Length);
+    if(Number > rbq_handle->slot_Number)
+        return RING_BUFFER_ERROR ;
+    uint32_t position = atomic_load_explicit(&rbq_handle->enqueue_position, memory_order_relaxed);
+    for(;;)
+    {
+        //检查从 position 开始的 Number 个槽位是否都已被上一轮的消费者释放
+        uint32_t i = 0 ;
+        int32_t difference = 0 ;
+        for(; i < Number; i++)
+        {
+            uint32_t sequence = atomic_load_explicit(&rbq_handle->slot_addr[(position + i) & rbq_handle->mask].sequence, memory_order_acquire);
+            difference = (int32_t)(sequence - (position + i));
+            if(difference)
+                break ;
+        }
+        if(i == Number)
+        {
+            //所有槽位空闲，一次领取全部槽位
+            if(atomic_compare_exchange_weak_explicit(&rbq_handle->enqueue_position, &position, position + Number,\
+                                                     memory_order_relaxed, memory_order_relaxed))
+                break ;
+        }
+        else if(difference < 0)
+            return RING_BUFFER_ERROR ;//槽位仍未被消费者释放，队列已满
+        else
+            position = atomic_load_explicit(&rbq_handle->enqueue_position, memory_order_relaxed);//其他生产者已领取，重新获取位置
+    }
+    ticket->position = position ;
+    ticket->Number = Number ;
+    RBQ_Make_Region(rbq_handle, position, reserve_Length, region);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)发布已预留并写入数据的分段
+ * \param[in] rbq_handle: 队列结构体句柄
+ * \param[in] ticket: RBQ_Write_Reserve 返回的预留槽位
+ * \param[in] commit_Length: 分段实际的字节数，不能超过预留的槽位空间
+ * \return 返回发布结果
+ *      \arg RING_BUFFER_SUCCESS: 发布成功
+ *      \arg RING_BUFFER_ERROR: 发布失败，长度超过预留空间(槽位仍以长度0的分段发布)
+*/
+uint8_t RBQ_Write_Commit(ring_buffer_mpmc *rbq_handle, ring_buffer_mpmc_ticket *ticket, uint32_t commit_Length)
+{
+    ring_buffer_mpmc_slot *slot = &(rbq_handle->slot_addr[ticket->position & rbq_handle->mask]);
+    uint8_t result = RING_BUFFER_SUCCESS ;
+    if((uint64_t)commit_Length > (uint64_t)ticket->Number * rbq_handle->slot_size)
+    {
+        commit_Length = 0 ;
+        result = RING_BUFFER_ERROR ;
+    }
+    atomic_store_explicit(&slot->Length, commit_Length, memory_order_relaxed);
+    atomic_store_explicit(&slot->Number, ticket->Number, memory_order_relaxed);
+    //发布点：消费者看到首个槽位的新序号时，数据与长度均已写入
+    atomic_store_explicit(&slot->sequence, ticket->position + 1, memory_order_release);
+    return result ;
+}
+
+/**
+ * \brief (生产者)写入一个完整分段
+ * \param[in] rbq_handle: 队列结构体句柄
+ * \param[in] input_addr: 待写入数据的基地址
+ * \param[in] write_Length: 要写入的字节数
+ * \return 返回写入结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 写入失败，队列没有足够的空闲槽位
+*/
+uint8_t RBQ_Write_Chapter(ring_buffer_mpmc *rbq_handle, uint8_t *input_addr, uint32_t write_Length)
+{
+    ring_buffer_vector vector ;
+    vector.addr = input_addr ;
+    vector.Length = write_Length ;
+    return RBQ_Write_Chapter_Vector(rbq_handle, &vector, 1);
+}
+
+/**
+ * \brief (生产者)将多段数据按顺序拼接写入为一个分段，全部写入或不做任何修改
+ * \param[in] rbq_handle: 队列结构体句柄
+ * \param[in] vector: 待写入的数据段描述数组
+ * \param[in] vector_Number: 数据段数量
+ * \return 返回写入结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 写入失败，队列没有足够的空闲槽位
+*/
+uint8_t RBQ_Write_Chapter_Vector(ring_buffer_mpmc *rbq_handle, const ring_buffer_vector *vector, uint32_t vector_Number)
+{
+    ring_buffer_region region ;
+    ring_buffer_mpmc_ticket ticket ;
+    uint32_t total = 0 ;
+    for(uint32_t i = 0; i < vector_Number; i++)
+    {
+        if(vector[i].Length > 0xFFFFFFFF - total)
+            return RING_BUFFER_ERROR ;
+        total += vector[i].Length ;
+    }
+    if(!RBQ_Write_Reserve(rbq_handle, total, &region, &ticket))
+        return RING_BUFFER_ERROR ;
+    RBC_Copy_Vector(&region, vector, vector_Number);
+    return RBQ_Write_Commit(rbq_handle, &ticket, total);
+}
+
+/**
+ * \brief (消费者)领取队首的分段，多个消费者可同时领取不同的分段，不拷贝数据
+ * \param[in] rbq_handle: 队列结构体句柄
+ * \param[out] region: 分段数据区域的描述，跨越数组末尾时分为a、b两段
+ * \param[out] ticket: 领取的槽位，释放时传回
+ * \return 返回领取结果
+ *      \arg RING_BUFFER_SUCCESS: 领取成功
+ *      \arg RING_BUFFER_ERROR: 领取失败，队首没有已发布的分段
+ * \note 处理完成后必须调用 RBQ_Read_Release，否则生产者无法复用这些槽位
+*/
+uint8_t RBQ_Read_Claim(ring_buffer_mpmc *rbq_handle, ring_buffer_region *region, ring_buffer_mpmc_ticket *ticket)
+{
+    uint32_t position = atomic_load_explicit(&rbq_handle->dequeue_position, memory_order_relaxed);
+    uint32_t Length, Number ;
+    for(;;)
+    {
+        ring_buffer_mpmc_slot *slot = &(rbq_handle->slot_addr[position & rbq_handle->mask]);
+        uint32_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int32_t difference = (int32_t)(sequence - (position + 1));
+        if(!difference)
+        {
+            //分段已发布，先读取长度，再领取其占用的全部槽位
+            Length = atomic_load_explicit(&slot->Length, memory_order_relaxed);
+            Number = atomic_load_explicit(&slot->Number, memory_order_relaxed);
+            if(atomic_compare_exchange_weak_explicit(&rbq_handle->dequeue_position, &position, position + Number,\
+                                                     memory_order_relaxed, memory_order_relaxed))
+                break ;
+        }
+        else if(difference < 0)
+            return RING_BUFFER_ERROR ;//队首分段尚未发布
+        else
+            position = atomic_load_explicit(&rbq_handle->dequeue_position, memory_order_relaxed);//其他消费者已领取
+    }
+    ticket->position = position ;
+    ticket->Number = Number ;
+    RBQ_Make_Region(rbq_handle, position, Length, region);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (消费者)释放已领取的分段，槽位交还给下一轮的生产者
+ * \param[in] rbq_handle: 队列结构体句柄
+ * \param[in] ticket: RBQ_Read_Claim 返回的领取槽位
+ * \return 返回释放结果
+ *      \arg RING_BUFFER_SUCCESS: 释放成功
+*/
+uint8_t RBQ_Read_Release(ring_buffer_mpmc *rbq_handle, ring_buffer_mpmc_ticket *ticket)
+{
+    //release 保证读完数据之后生产者才能复用槽位
+    for(uint32_t i = 0; i < ticket->Number; i++)
+        atomic_store_explicit(&rbq_handle->slot_addr[(ticket->position + i) & rbq_handle->mask].sequence,\
+                              ticket->position + i + rbq_handle->slot_Number, memory_order_release);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (消费者)读取队首的完整分段
+ * \param[in] rbq_handle: 队列结构体句柄
+ * \param[out] output_addr: 读取的分段数据保存地址，空间应不小于最长的分段
+ * \param[out] output_Length: 读取的分段数据长度保存地址，可为NULL
+ * \return 返回读取结果
+ *      \arg RING_BUFFER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_ERROR: 读取失败，队首没有已发布的分段
+*/
+uint8_t RBQ_Read_Chapter(ring_buffer_mpmc *rbq_handle, uint8_t *output_addr, uint32_t *output_Length)
+{
+    ring_buffer_region region ;
+    ring_buffer_mpmc_ticket ticket ;
+    if(!RBQ_Read_Claim(rbq_handle, &region, &ticket))
+        return RING_BUFFER_ERROR ;
+    memcpy(output_addr, region.addr_a, region.Length_a);
+    if(region.Length_b)
+        memcpy(output_addr + region.Length_a, region.addr_b, region.Length_b);
+    if(output_Length != NULL)
+        *output_Length = region.Length_a + region.Length_b ;
+    return RBQ_Read_Release(rbq_handle, &ticket);
+}
+
+/**
+ * \brief 获取已被生产者领取、尚未被消费者领取的槽位数量
+ * \param[in] rbq_handle: 队列结构体句柄
+ * \return 返回槽位数量，并发访问时仅为近似值
+*/
+uint32_t RBQ_Get_Used_Slots(ring_buffer_mpmc *rbq_handle)
+{
+    uint32_t dequeue = atomic_load_explicit(&rbq_handle->dequeue_position, memory_order_acquire);
+    uint32_t Number = atomic_load_explicit(&rbq_handle->enqueue_position, memory_order_acquire) - dequeue ;
+    return (Number > rbq_handle->slot_Number) ? 0 : Number ;
+}
@@ -0,0 +1,67 @@
+/**
+ * \file ring_buffer_mpmc.h
+ * \brief 多生产者多消费者有界分段队列相关定义与声明
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_MPMC_H_
+#define _RING_BUFFER_MPMC_H_
+
+#include <stdint.h>
+#include "ring_buffer.h"
+#include "ring_buffer_chapter.h"
+#include "ring_buffer_atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//槽位状态，每个槽位对应数据数组中 slot_size 字节
+typedef struct
+{
+    RB_ATOMIC(uint32_t) sequence ;  //槽位序号：等于位置时空闲，等于位置+1时已发布分段
+    RB_ATOMIC(uint32_t) Length ;    //(分段首个槽位)分段的字节数
+    RB_ATOMIC(uint32_t) Number ;    //(分段首个槽位)分段占用的槽位数量
+}ring_buffer_mpmc_slot;
+
+//预留或领取的分段，提交或释放时传回
+typedef struct
+{
+    uint32_t position ;             //首个槽位的位置
+    uint32_t Number ;               //占用的槽位数量
+}ring_buffer_mpmc_ticket;
+
+//多生产者多消费者分段队列结构体
+//数据数组按 slot_size 划分为 slot_Number 个槽位，每个分段占用连续的 ceil(长度/slot_size) 个槽位，
+//生产者与消费者分别通过比较交换一次领取多个槽位，位置为自由递增的 uint32_t 计数(自然溢出)
+typedef struct
+{
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) enqueue_position ;   //生产者领取位置
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) dequeue_position ;   //消费者领取位置
+    //初始化后只读的共享参数
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) ring_buffer_mpmc_slot *slot_addr ;       //槽位状态数组
+    uint8_t *array_addr ;                                                   //数据数组基地址
+    uint32_t slot_Number ;                                                  //槽位数量，2的幂
+    uint32_t mask ;                                                         //槽位下标掩码(slot_Number - 1)
+    uint32_t slot_size ;                                                    //每个槽位的数据字节数
+}ring_buffer_mpmc;
+
+uint8_t RBQ_Init(ring_buffer_mpmc *rbq_handle, ring_buffer_mpmc_slot *slot_addr, uint32_t slot_Number,\
+                 uint8_t *buffer_addr, uint32_t slot_size);                                                          //初始化分段队列
+uint8_t RBQ_Write_Chapter(ring_buffer_mpmc *rbq_handle, uint8_t *input_addr, uint32_t write_Length);                  //(生产者)写入一个完整分段
+uint8_t RBQ_Write_Chapter_Vector(ring_buffer_mpmc *rbq_handle, const ring_buffer_vector *vector, uint32_t vector_Number); //(生产者)将多段数据写入为一个分段
+uint8_t RBQ_Write_Reserve(ring_buffer_mpmc *rbq_handle, uint32_t reserve_Length,\
+                          ring_buffer_region *region, ring_buffer_mpmc_ticket *ticket);                             //(生产者)预留一个分段的可写区域
+uint8_t RBQ_Write_Commit(ring_buffer_mpmc *rbq_handle, ring_buffer_mpmc_ticket *ticket, uint32_t commit_Length);       //(生产者)发布已预留的分段
+uint8_t RBQ_Read_Chapter(ring_buffer_mpmc *rbq_handle, uint8_t *output_addr, uint32_t *output_Length);                //(消费者)读取一个完整分段
+uint8_t RBQ_Read_Claim(ring_buffer_mpmc *rbq_handle, ring_buffer_region *region, ring_buffer_mpmc_ticket *ticket);    //(消费者)领取一个分段(不拷贝)
+uint8_t RBQ_Read_Release(ring_buffer_mpmc *rbq_handle, ring_buffer_mpmc_ticket *ticket);                              //(消费者)释放已领取的分段
+uint32_t RBQ_Get_Used_Slots(ring_buffer_mpmc *rbq_handle);                                                            //获取已领取的槽位数量(近似值)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_MPMC_H_
@@ -0,0 +1,235 @@
+/**
+ * \file ring_buffer_search.c
+ * \brief 环形缓冲内的分隔符查找与按分隔符自动分段的实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "ring_buffer_search.h"
+#include "ring_buffer_chapter_internal.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define RB_SEARCH_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * 字节扫描：x86 上默认使用 SSE2 每次比较16字节，首次扫描时检测到 AVX2 则之后每次比较32字节，
+ * 其余平台逐字节比较；返回第一个匹配字节的地址，没有匹配时返回NULL
+*/
+
+static const uint8_t *RB_Scan_Scalar(const uint8_t *addr, uint32_t Length, uint8_t value)
+{
+    for(uint32_t i = 0; i < Length; i++)
+        if(addr[i] == value)
+            return addr + i ;
+    return NULL ;
+}
+
+#ifdef RB_SEARCH_X86
+static const uint8_t *RB_Scan_SSE2(const uint8_t *addr, uint32_t Length, uint8_t value)
+{
+    __m128i needle = _mm_set1_epi8((char)value);
+    uint32_t i = 0 ;
+    for(; i + 16 <= Length; i += 16)
+    {
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(addr + i)), needle));
+        if(mask)
+            return addr + i + (uint32_t)__builtin_ctz((unsigned int)mask);
+    }
+    return RB_Scan_Scalar(addr + i, Length - i, value);
+}
+
+__attribute__((target("avx2")))
+static const uint8_t *RB_Scan_AVX2(const uint8_t *addr, uint32_t Length, uint8_t value)
+{
+    __m256i needle = _mm256_set1_epi8((char)value);
+    uint32_t i = 0 ;
+    for(; i + 32 <= Length; i += 32)
+    {
+        int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(addr + i)), needle));
+        if(mask)
+            return addr + i + (uint32_t)__builtin_ctz((unsigned int)mask);
+    }
+    return RB_Scan_SSE2(addr + i, Length - i, value);
+}
+
+typedef const uint8_t *(*rb_scan_kernel)(const uint8_t *addr, uint32_t Length, uint8_t value);
+static const uint8_t *RB_Scan_Select(const uint8_t *addr, uint32_t Length, uint8_t value);
+
+//不短于32字节的扫描使用的内核，首次调用时由 RB_Scan_Select 检测一次 CPU 特性后替换，之后直接调用
+static _Atomic(rb_scan_kernel) rb_scan_long = RB_Scan_Select ;
+
+static const uint8_t *RB_Scan_Select(const uint8_t *addr, uint32_t Length, uint8_t value)
+{
+    rb_scan_kernel kernel = __builtin_cpu_supports("avx2") ? RB_Scan_AVX2 : RB_Scan_SSE2 ;
+    //多个线程同时首次调用时写入的是同一个值
+    atomic_store_explicit(&rb_scan_long, kernel, memory_order_relaxed);
+    return kernel(addr, Length, value);
+}
+#endif
+
+static const uint8_t *RB_Scan(const uint8_t *addr, uint32_t Length, uint8_t value)
+{
+#ifdef RB_SEARCH_X86
+    if(Length >= 32)
+        return atomic_load_explicit(&rb_scan_long, memory_order_relaxed)(addr, Length, value);
+    return RB_Scan_SSE2(addr, Length, value);
+#else
+    return RB_Scan_Scalar(addr, Length, value);
+#endif
+}
+
+//在已储存数据的 [start, end) 范围内查找字节，位置均相对头指针，区域可能被数组末尾拆成a、b两段
+static uint8_t RB_Region_Find(ring_buffer_region *region, uint32_t start, uint32_t end, uint8_t value, uint32_t *output_Position)
+{
+    const uint8_t *match ;
+    if(start < region->Length_a)
+    {
+        uint32_t stop = (end < region->Length_a) ? end : region->Length_a ;
+        match = RB_Scan(region->addr_a + start, stop - start, value);
+        if(match != NULL)
+        {
+            *output_Position = (uint32_t)(match - region->addr_a);
+            return RING_BUFFER_SUCCESS ;
+        }
+        start = region->Length_a ;
+    }
+    if(start < end)
+    {
+        match = RB_Scan(region->addr_b + (start - region->Length_a), end - start, value);
+        if(match != NULL)
+        {
+            *output_Position = region->Length_a + (uint32_t)(match - region->addr_b);
+            return RING_BUFFER_SUCCESS ;
+        }
+    }
+    return RING_BUFFER_ERROR ;
+}
+
+//读取区域中相对头指针 position 处的字节
+static uint8_t RB_Region_Byte(ring_buffer_region *region, uint32_t position)
+{
+    if(position < region->Length_a)
+        return region->addr_a[position];
+    return region->addr_b[position - region->Length_a];
+}
+
+/**
+ * \brief 在已储存的数据中查找指定字节，跨越数组末尾的数据无需拷贝
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \param[in] start: 开始查找的位置，相对头指针的偏移
+ * \param[in] value: 要查找的字节
+ * \param[out] output_Position: 第一个匹配字节相对头指针的偏移
+ * \return 返回查找结果
+ *      \arg RING_BUFFER_SUCCESS: 找到匹配
+ *      \arg RING_BUFFER_ERROR: 没有匹配
+*/
+uint8_t RB_Find_Byte(ring_buffer *rb_handle, uint32_t start, uint8_t value, uint32_t *output_Position)
+{
+    ring_buffer_region region ;
+    uint32_t Length = RB_Get_Length(rb_handle);
+    if(start >= Length)
+        return RING_BUFFER_ERROR ;
+    RB_Read_Peek(rb_handle, Length, &region);
+    return RB_Region_Find(&region, start, Length, value, output_Position);
+}
+
+/**
+ * \brief 在已储存的数据中查找指定的字节序列(适用于较短的帧标记)，匹配可以跨越数组末尾
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \param[in] start: 开始查找的位置，相对头指针的偏移
+ * \param[in] pattern_addr: 要查找的字节序列
+ * \param[in] pattern_Length: 字节序列长度，不能为0
+ * \param[out] output_Position: 第一个匹配序列的起始字节相对头指针的偏移
+ * \return 返回查找结果
+ *      \arg RING_BUFFER_SUCCESS: 找到匹配
+ *      \arg RING_BUFFER_ERROR: 没有匹配
+*/
+uint8_t RB_Find_String(ring_buffer *rb_handle, uint32_t start, const uint8_t *pattern_addr,\
+                       uint32_t pattern_Length, uint32_t *output_Position)
+{
+    ring_buffer_region region ;
+    uint32_t Length = RB_Get_Length(rb_handle);
+    if(!pattern_Length || pattern_Length > Length || start > Length - pattern_Length)
+        return RING_BUFFER_ERROR ;
+    RB_Read_Peek(rb_handle, Length, &region);
+    //用向量扫描定位首字节，再逐字节比较其余部分
+    uint32_t end = Length - pattern_Length + 1 ;
+    uint32_t position ;
+    while(start < end && RB_Region_Find(&region, start, end, pattern_addr[0], &position))
+    {
+        uint32_t i = 1 ;
+        while(i < pattern_Length && RB_Region_Byte(&region, position + i) == pattern_addr[i])
+            i ++ ;
+        if(i == pattern_Length)
+        {
+            *output_Position = position ;
+            return RING_BUFFER_SUCCESS ;
+        }
+        start = position + 1 ;
+    }
+    return RING_BUFFER_ERROR ;
+}
+
+/**
+ * \brief 向尾分段写入数据，并在数据中的每个分隔符之后自动结尾一个分段(分隔符计入该分段)，
+ *        最后一个分隔符之后的数据留在尾分段中，等待后续写入
+ * \param[out] rbc_handle: 分段版环形缓冲区结构体句柄
+ * \param[in] input_addr: 待写入数据的基地址
+ * \param[in] write_Length: 要写入的字节数
+ * \param[in] delimiter: 分隔符
+ * \param[out] output_Number: 本次结尾的分段数量，可为NULL
+ * \return 返回写入结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 写入失败，数据环或分段环空间不足(覆盖模式下丢弃全部完整分段也放不下)，缓冲区保持不变
+ * \note 数据只拷贝一次，分段结束位置直接写入分段环
+*/
+uint8_t RBC_Write_Delimited(ring_buffer_chapter *rbc_handle, uint8_t *input_addr, uint32_t write_Length,\
+                            uint8_t delimiter, uint32_t *output_Number)
+{
+    const uint8_t *match ;
+    uint32_t number = 0, last = 0 ;
+    if(output_Number != NULL)
+        *output_Number = 0 ;
+    if(!write_Length)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //先统计分隔符数量，确定需要的分段记录条数：每个分隔符一条，另有剩余数据时为尾分段保留一条
+    for(uint32_t i = 0; (match = RB_Scan(input_addr + i, write_Length - i, delimiter)) != NULL; )
+    {
+        number ++ ;
+        i = (uint32_t)(match - input_addr) + 1 ;
+        last = i ;
+    }
+    uint32_t need = number + ((last < write_Length) ? 1 : 0);
+    //覆盖模式下一次丢弃足够数量的头分段，放不下时不丢弃任何分段
+    if(((rbc_handle->flags & RING_BUFFER_CHAPTER_FLAG_OVERWRITE) && !RBC_Make_Room(rbc_handle, write_Length, need))
+        || RBC_Get_Base_Free_Size(rbc_handle) < write_Length || RBC_Get_Chapter_Free_Size(rbc_handle) < need)
+    {
+        RBC_STATS_ADD(rbc_handle, write_rejected, 1);
+        return RING_BUFFER_CHAPTER_ERROR ;
+    }
+    //写入前数据环尾指针对应的绝对偏移，第 i 个字节之后的结束位置为 offset + i + 1
+    uint32_t offset = rbc_handle->head_offset + RB_Get_Length(&(rbc_handle->base_handle));
+    RB_Write_String(&(rbc_handle->base_handle), input_addr, write_Length);
+    for(uint32_t i = 0; i < last; )
+    {
+        match = RB_Scan(input_addr + i, last - i, delimiter);
+        i = (uint32_t)(match - input_addr) + 1 ;
+        uint32_t end = offset + i ;
+        RB_Write_String(&(rbc_handle->chapter_handle), (uint8_t *)&end, 4);
+    }
+    if(number)
+        rbc_handle->tail_chapter_length = write_Length - last ;
+    else
+        rbc_handle->tail_chapter_length += write_Length ;
+    RBC_STATS_ADD(rbc_handle, chapters_ended, number);
+    if(output_Number != NULL)
+        *output_Number = number ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
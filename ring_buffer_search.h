@@ -0,0 +1,30 @@
+/**
+ * \file ring_buffer_search.h
+ * \brief 环形缓冲内的分隔符查找与按分隔符自动分段相关声明
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_SEARCH_H_
+#define _RING_BUFFER_SEARCH_H_
+
+#include <stdint.h>
+#include "ring_buffer.h"
+#include "ring_buffer_chapter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint8_t RB_Find_Byte(ring_buffer *rb_handle, uint32_t start, uint8_t value, uint32_t *output_Position);          //从头指针后 start 处开始查找指定字节
+uint8_t RB_Find_String(ring_buffer *rb_handle, uint32_t start, const uint8_t *pattern_addr,\
+                       uint32_t pattern_Length, uint32_t *output_Position);                                      //从头指针后 start 处开始查找指定字节序列
+uint8_t RBC_Write_Delimited(ring_buffer_chapter *rbc_handle, uint8_t *input_addr, uint32_t write_Length,\
+                            uint8_t delimiter, uint32_t *output_Number);                                          //写入数据并在每个分隔符之后自动分段结尾
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_SEARCH_H_
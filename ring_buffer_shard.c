@@ -0,0 +1,159 @@
+/**
+ * \file ring_buffer_shard.c
+ * \brief 按核心/线程分片的分段队列集合的实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#include <stdint.h>
+#include <stddef.h>
+#include "ring_buffer_shard.h"
+
+/*
+ * 每个生产者只写入自己的分片，分片之间没有共享的缓存行；
+ * 消费者先处理本地分片，本地分片为空时依次从其他分片窃取一批分段；
+ * 保序模式下每个分片同一时间只允许一个消费者处理(尝试加锁，失败时跳过该分片)，
+ * 只要生产者始终写入同一个分片，它写入的分段就按写入顺序被处理
+*/
+
+/**
+ * \brief 初始化分片集合，槽位状态数组与数据数组按分片数量平均划分
+ * \param[out] rbsd_handle: 待初始化的分片集合句柄
+ * \param[in] shard_addr: 外部定义的分片数组，元素数量为 shard_Number
+ * \param[in] shard_Number: 分片数量，通常等于核心数或生产者线程数
+ * \param[in] slot_addr: 外部定义的槽位状态数组，元素数量为 shard_Number * slot_Number
+ * \param[in] slot_Number: 每个分片的槽位数量，必须为2的幂
+ * \param[in] buffer_addr: 外部定义的数据数组，空间为 shard_Number * slot_Number * slot_size
+ * \param[in] slot_size: 每个槽位的数据字节数
+ * \param[in] flags: 工作模式标志位，0 或 RING_BUFFER_SHARD_FLAG_ORDERED
+ * \return 返回初始化的结果
+ *      \arg RING_BUFFER_SUCCESS: 初始化成功
+ *      \arg RING_BUFFER_ERROR: 初始化失败
+*/
+uint8_t RBSD_Init(ring_buffer_sharded *rbsd_handle, ring_buffer_shard *shard_addr, uint32_t shard_Number,\
+                  ring_buffer_mpmc_slot *slot_addr, uint32_t slot_Number, uint8_t *buffer_addr, uint32_t slot_size,\
+                  uint8_t flags)
+{
+    if(!shard_Number)
+        return RING_BUFFER_ERROR ;
+    for(uint32_t i = 0; i < shard_Number; i++)
+    {
+        if(!RBQ_Init(&(shard_addr[i].queue), slot_addr + (size_t)i * slot_Number, slot_Number,\
+                     buffer_addr + (size_t)i * slot_Number * slot_size, slot_size))
+            return RING_BUFFER_ERROR ;
+        atomic_init(&(shard_addr[i].drain_lock), 0);
+    }
+    rbsd_handle->shard_addr = shard_addr ;
+    rbsd_handle->shard_Number = shard_Number ;
+    rbsd_handle->flags = flags ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 获取当前线程所在核心对应的分片编号
+ * \param[in] rbsd_handle: 分片集合句柄
+ * \return 返回分片编号，无法获取核心编号时返回0
+ * \note 线程可能被迁移到其他核心，保序模式下生产者应固定使用同一个分片编号，而不是每次调用本函数
+*/
+uint32_t RBSD_Get_Local_Shard(ring_buffer_sharded *rbsd_handle)
+{
+#ifdef __linux__
+    int cpu = sched_getcpu();
+    if(cpu >= 0)
+        return (uint32_t)cpu % rbsd_handle->shard_Number ;
+#endif
+    return 0 ;
+}
+
+/**
+ * \brief (生产者)向指定分片写入一个完整分段
+ * \param[in] rbsd_handle: 分片集合句柄
+ * \param[in] shard_Index: 分片编号，通常为生产者线程固定分配的编号或 RBSD_Get_Local_Shard 的返回值
+ * \param[in] input_addr: 待写入数据的基地址
+ * \param[in] write_Length: 要写入的字节数
+ * \return 返回写入结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 写入失败，分片已满或分片编号无效
+*/
+uint8_t RBSD_Write_Chapter(ring_buffer_sharded *rbsd_handle, uint32_t shard_Index, uint8_t *input_addr, uint32_t write_Length)
+{
+    if(shard_Index >= rbsd_handle->shard_Number)
+        return RING_BUFFER_ERROR ;
+    return RBQ_Write_Chapter(&(rbsd_handle->shard_addr[shard_Index].queue), input_addr, write_Length);
+}
+
+//处理一个分片中最多 max_Number 个分段，返回处理的数量；保序模式下加锁失败时返回0
+static uint32_t RBSD_Drain_Shard(ring_buffer_sharded *rbsd_handle, uint32_t shard_Index, uint32_t max_Number,\
+                                 ring_buffer_shard_callback callback, void *context)
+{
+    ring_buffer_shard *shard = &(rbsd_handle->shard_addr[shard_Index]);
+    ring_buffer_region region ;
+    ring_buffer_mpmc_ticket ticket ;
+    uint32_t count = 0 ;
+    uint8_t ordered = rbsd_handle->flags & RING_BUFFER_SHARD_FLAG_ORDERED ;
+    if(ordered)
+    {
+        //先检查再加锁，空分片不产生写操作
+        if(!RBQ_Get_Used_Slots(&(shard->queue)) || atomic_load_explicit(&(shard->drain_lock), memory_order_relaxed) ||\
+           atomic_exchange_explicit(&(shard->drain_lock), 1, memory_order_acquire))
+            return 0 ;
+    }
+    while(count < max_Number && RBQ_Read_Claim(&(shard->queue), &region, &ticket))
+    {
+        callback(context, shard_Index, &region);
+        RBQ_Read_Release(&(shard->queue), &ticket);
+        count ++ ;
+    }
+    if(ordered)
+        atomic_store_explicit(&(shard->drain_lock), 0, memory_order_release);
+    return count ;
+}
+
+/**
+ * \brief (消费者)处理分段：先处理本地分片，本地分片为空时依次从其他分片窃取一批分段
+ * \param[in] rbsd_handle: 分片集合句柄
+ * \param[in] home_Index: 消费者的本地分片编号
+ * \param[in] max_Number: 从本地分片最多处理的分段数量
+ * \param[in] steal_Number: 本地分片为空时，从一个其他分片最多窃取的分段数量
+ * \param[in] callback: 分段处理回调，回调返回后分段即被释放
+ * \param[in] context: 传给回调的参数
+ * \return 返回本次处理的分段数量，为0时表示所有分片均为空(或保序模式下正被其他消费者处理)
+*/
+uint32_t RBSD_Drain(ring_buffer_sharded *rbsd_handle, uint32_t home_Index, uint32_t max_Number, uint32_t steal_Number,\
+                    ring_buffer_shard_callback callback, void *context)
+{
+    if(home_Index >= rbsd_handle->shard_Number)
+        return 0 ;
+    uint32_t count = RBSD_Drain_Shard(rbsd_handle, home_Index, max_Number, callback, context);
+    if(count)
+        return count ;
+    //从本地分片的下一个分片开始窃取，各消费者的起点不同，减少彼此的竞争
+    for(uint32_t i = 1; i < rbsd_handle->shard_Number; i++)
+    {
+        uint32_t index = home_Index + i ;
+        if(index >= rbsd_handle->shard_Number)
+            index -= rbsd_handle->shard_Number ;
+        count = RBSD_Drain_Shard(rbsd_handle, index, steal_Number, callback, context);
+        if(count)
+            return count ;
+    }
+    return 0 ;
+}
+
+/**
+ * \brief 获取所有分片已占用的槽位数量
+ * \param[in] rbsd_handle: 分片集合句柄
+ * \return 返回槽位数量，并发访问时仅为近似值
+*/
+uint32_t RBSD_Get_Used_Slots(ring_buffer_sharded *rbsd_handle)
+{
+    uint32_t Number = 0 ;
+    for(uint32_t i = 0; i < rbsd_handle->shard_Number; i++)
+        Number += RBQ_Get_Used_Slots(&(rbsd_handle->shard_addr[i].queue));
+    return Number ;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file ring_buffer_shard.h
+ * \brief 按核心/线程分片的分段队列集合相关定义与声明
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_SHARD_H_
+#define _RING_BUFFER_SHARD_H_
+
+#include <stdint.h>
+#include "ring_buffer_mpmc.h"
+#include "ring_buffer_atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//工作模式标志位定义
+#define RING_BUFFER_SHARD_FLAG_ORDERED      0x01    //保序模式：同一分片同时只由一个消费者处理，每个生产者写入的分段按写入顺序被处理
+
+//分片，每个分片是一个独立的分段队列
+typedef struct
+{
+    ring_buffer_mpmc queue ;                                          //分片的分段队列
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) drain_lock ;   //(保序模式)分片处理锁，0 空闲，1 正在被某个消费者处理
+}ring_buffer_shard;
+
+//分片集合结构体
+typedef struct
+{
+    ring_buffer_shard *shard_addr ;     //分片数组
+    uint32_t shard_Number ;             //分片数量
+    uint8_t flags ;                     //工作模式标志位
+}ring_buffer_sharded;
+
+//分段处理回调，region 为分段数据所在区域，跨越数组末尾时分为a、b两段，回调返回后分段即被释放
+typedef void (*ring_buffer_shard_callback)(void *context, uint32_t shard_Index, ring_buffer_region *region);
+
+uint8_t RBSD_Init(ring_buffer_sharded *rbsd_handle, ring_buffer_shard *shard_addr, uint32_t shard_Number,\
+                  ring_buffer_mpmc_slot *slot_addr, uint32_t slot_Number, uint8_t *buffer_addr, uint32_t slot_size,\
+                  uint8_t flags);                                                                                     //初始化分片集合
+uint32_t RBSD_Get_Local_Shard(ring_buffer_sharded *rbsd_handle);                                                     //获取当前核心对应的分片编号
+uint8_t RBSD_Write_Chapter(ring_buffer_sharded *rbsd_handle, uint32_t shard_Index, uint8_t *input_addr, uint32_t write_Length); //(生产者)向指定分片写入一个分段
+uint32_t RBSD_Drain(ring_buffer_sharded *rbsd_handle, uint32_t home_Index, uint32_t max_Number, uint32_t steal_Number,\
+                    ring_buffer_shard_callback callback, void *context);                                             //(消费者)先处理本地分片，空闲时从其他分片窃取
+uint32_t RBSD_Get_Used_Slots(ring_buffer_sharded *rbsd_handle);                                                      //获取所有分片已占用的槽位数量(近似值)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_SHARD_H_
@@ -0,0 +1,396 @@
+/**
+ * \file ring_buffer_shm.c
+ * \brief 跨进程共享内存分段环形缓冲的实现(POSIX)
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ring_buffer_shm.h"
+#include "ring_buffer_copy.h"
+
+/*
+ * 提交与恢复：
+ * 生产者先写数据与分段记录，最后以 release 写入 chapter_tail，这是唯一的提交点；
+ * 尚未结尾的尾分段只记录在生产者进程的句柄里，生产者崩溃后这部分数据自然丢弃。
+ * 消费者先写 head 再写 chapter_head，若在两次写入之间崩溃，重新打开时
+ * 将结束位置不超过 head 的分段记录补充释放，即可恢复到一致状态。
+*/
+
+//以 '/' 开头且不含其他 '/' 的名称使用 shm_open，其余按文件路径打开
+static int RBSM_Open_Fd(const char *name, int flags)
+{
+    if(name[0] == '/' && strchr(name + 1, '/') == NULL)
+        return shm_open(name, flags, 0600);
+    return open(name, flags | O_CLOEXEC, 0600);
+}
+
+//根据头部中的偏移设置本进程的数组地址
+static void RBSM_Attach(ring_buffer_shm *rbsm_handle, uint8_t *addr, uint32_t map_size)
+{
+    rbsm_handle->header = (ring_buffer_shm_header *)addr ;
+    rbsm_handle->chapter_addr = (uint32_t *)(addr + rbsm_handle->header->chapter_offset);
+    rbsm_handle->array_addr = addr + rbsm_handle->header->base_offset ;
+    rbsm_handle->map_size = map_size ;
+}
+
+//将从绝对位置 position 开始、长度为 Length 的数据区域描述为a、b两段
+static void RBSM_Make_Region(ring_buffer_shm *rbsm_handle, uint32_t position, uint32_t Length, ring_buffer_region *region)
+{
+    uint32_t index = position & (rbsm_handle->header->base_size - 1);
+    uint32_t size_a = rbsm_handle->header->base_size - index ;
+    region->addr_a = rbsm_handle->array_addr + index ;
+    if(Length > size_a)
+    {
+        region->Length_a = size_a ;
+        region->addr_b = rbsm_handle->array_addr ;
+        region->Length_b = Length - size_a ;
+    }
+    else
+    {
+        region->Length_a = Length ;
+        region->addr_b = NULL ;
+        region->Length_b = 0 ;
+    }
+}
+
+/**
+ * \brief 创建共享段并映射，已存在的同名共享段会被清空重建
+ * \param[out] rbsm_handle: 待初始化的进程内句柄
+ * \param[in] name: 共享段名称，"/name" 形式使用 POSIX 共享内存，其余视为文件路径
+ * \param[in] base_size: 数据数组空间，必须为2的幂
+ * \param[in] chapter_size: 可记录的分段数量，必须为2的幂
+ * \return 返回创建结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 创建成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 创建失败
+*/
+uint8_t RBSM_Create(ring_buffer_shm *rbsm_handle, const char *name, uint32_t base_size, uint32_t chapter_size)
+{
+    if(base_size < 2 || (base_size & (base_size - 1)) || !chapter_size || (chapter_size & (chapter_size - 1)))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //头部、分段记录数组、数据数组依次排列，各部分按缓存行对齐
+    uint64_t chapter_offset = sizeof(ring_buffer_shm_header);
+    uint64_t base_offset = (chapter_offset + (uint64_t)chapter_size * 4 + RB_CACHE_LINE_SIZE - 1) / RB_CACHE_LINE_SIZE * RB_CACHE_LINE_SIZE ;
+    uint64_t map_size = base_offset + base_size ;
+    if(map_size > 0xFFFFFFFF)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    int fd = RBSM_Open_Fd(name, O_RDWR | O_CREAT | O_TRUNC);
+    if(fd < 0)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    if(ftruncate(fd, (off_t)map_size) != 0)
+    {
+        close(fd);
+        return RING_BUFFER_CHAPTER_ERROR ;
+    }
+    uint8_t *addr = mmap(NULL, (size_t)map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);//映射建立后文件描述符不再需要
+    if(addr == MAP_FAILED)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //截断后的内容全部为0，填写布局参数后最后写入 magic
+    ring_buffer_shm_header *header = (ring_buffer_shm_header *)addr ;
+    header->version = RBSM_VERSION ;
+    header->base_size = base_size ;
+    header->chapter_size = chapter_size ;
+    header->chapter_offset = (uint32_t)chapter_offset ;
+    header->base_offset = (uint32_t)base_offset ;
+    atomic_store_explicit(&header->chapter_tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&header->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&header->chapter_head, 0, memory_order_relaxed);
+    atomic_store_explicit(&header->magic, RBSM_MAGIC, memory_order_release);
+    RBSM_Attach(rbsm_handle, addr, (uint32_t)map_size);
+    rbsm_handle->tail = 0 ;
+    rbsm_handle->tail_chapter_length = 0 ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 映射已存在的共享段，校验布局并恢复到最近一次提交后的一致状态
+ * \param[out] rbsm_handle: 待初始化的进程内句柄
+ * \param[in] name: 共享段名称，规则同 RBSM_Create
+ * \return 返回打开结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 打开成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 打开失败，共享段不存在、未初始化完成或内容不一致
+ * \note 生产者崩溃前未结尾的尾分段被丢弃，重新打开后从最后一个已提交分段之后继续写入
+*/
+uint8_t RBSM_Open(ring_buffer_shm *rbsm_handle, const char *name)
+{
+    int fd = RBSM_Open_Fd(name, O_RDWR);
+    if(fd < 0)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    struct stat status ;
+    if(fstat(fd, &status) != 0 || status.st_size < (off_t)sizeof(ring_buffer_shm_header) || status.st_size > 0xFFFFFFFF)
+    {
+        close(fd);
+        return RING_BUFFER_CHAPTER_ERROR ;
+    }
+    uint32_t map_size = (uint32_t)status.st_size ;
+    uint8_t *addr = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(addr == MAP_FAILED)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    //校验布局参数，避免按损坏的偏移访问越界
+    ring_buffer_shm_header *header = (ring_buffer_shm_header *)addr ;
+    uint32_t base_size = header->base_size, chapter_size = header->chapter_size ;
+    if(atomic_load_explicit(&header->magic, memory_order_acquire) != RBSM_MAGIC || header->version != RBSM_VERSION ||\
+       base_size < 2 || (base_size & (base_size - 1)) || !chapter_size || (chapter_size & (chapter_size - 1)) ||\
+       header->chapter_offset < sizeof(ring_buffer_shm_header) || header->chapter_offset % 4 ||\
+       (uint64_t)header->chapter_offset + (uint64_t)chapter_size * 4 > header->base_offset ||\
+       (uint64_t)header->base_offset + base_size > map_size)
+    {
+        munmap(addr, map_size);
+        return RING_BUFFER_CHAPTER_ERROR ;
+    }
+    RBSM_Attach(rbsm_handle, addr, map_size);
+    uint32_t chapter_tail = atomic_load_explicit(&header->chapter_tail, memory_order_acquire);
+    //消费者先写 head 后写 chapter_head，这里按相反顺序读取，读到的 head 不会比 chapter_head 旧
+    uint32_t chapter_head = atomic_load_explicit(&header->chapter_head, memory_order_acquire);
+    uint32_t head = atomic_load_explicit(&header->head, memory_order_acquire);
+    //消费者在写入 head 与 chapter_head 之间崩溃时，补充释放结束位置不超过 head 的分段记录；
+    //使用比较交换，与仍在运行的消费者写入的是同一个值
+    while(chapter_tail - chapter_head <= chapter_size && chapter_head != chapter_tail &&\
+          (int32_t)(rbsm_handle->chapter_addr[chapter_head & (chapter_size - 1)] - head) <= 0)
+    {
+        if(atomic_compare_exchange_strong(&header->chapter_head, &chapter_head, chapter_head + 1))
+            chapter_head ++ ;
+    }
+    //生产者从最后一个已提交分段的结束位置继续写入，分段已全部释放时该记录仍是写入位置，
+    //不能用 head 代替(消费者可能正在释放最后一个分段)；只有从未提交过分段时才从 head 开始
+    uint32_t tail = chapter_tail ? rbsm_handle->chapter_addr[(chapter_tail - 1) & (chapter_size - 1)] : head ;
+    if(chapter_tail - chapter_head > chapter_size || tail - head > base_size)
+    {
+        munmap(addr, map_size);
+        return RING_BUFFER_CHAPTER_ERROR ;
+    }
+    rbsm_handle->tail = tail ;
+    rbsm_handle->tail_chapter_length = 0 ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 解除本进程的映射，共享段及其中的数据保留
+ * \param[out] rbsm_handle: 进程内句柄
+ * \return 返回解除结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 解除成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 解除失败，句柄未映射
+*/
+uint8_t RBSM_Close(ring_buffer_shm *rbsm_handle)
+{
+    if(rbsm_handle->header == NULL)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    munmap(rbsm_handle->header, rbsm_handle->map_size);
+    rbsm_handle->header = NULL ;
+    rbsm_handle->chapter_addr = NULL ;
+    rbsm_handle->array_addr = NULL ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 删除共享段，已映射的进程仍可继续使用到解除映射为止
+ * \param[in] name: 共享段名称，规则同 RBSM_Create
+ * \return 返回删除结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 删除成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 删除失败
+*/
+uint8_t RBSM_Unlink(const char *name)
+{
+    int result ;
+    if(name[0] == '/' && strchr(name + 1, '/') == NULL)
+        result = shm_unlink(name);
+    else
+        result = unlink(name);
+    return result == 0 ? RING_BUFFER_CHAPTER_SUCCESS : RING_BUFFER_CHAPTER_ERROR ;
+}
+
+/**
+ * \brief (生产者)获取数据数组剩余可用空间，未结尾的尾分段数据计为已占用
+ * \param[in] rbsm_handle: 进程内句柄
+ * \return 返回数据数组剩余可用空间
+*/
+uint32_t RBSM_Get_Base_Free_Size(ring_buffer_shm *rbsm_handle)
+{
+    uint32_t head = atomic_load_explicit(&rbsm_handle->header->head, memory_order_acquire);
+    return rbsm_handle->header->base_size - (rbsm_handle->tail - head);
+}
+
+//(生产者)检查是否可以再写入 Length 字节，并为尾分段保留一条分段记录
+static uint8_t RBSM_Check_Writable(ring_buffer_shm *rbsm_handle, uint32_t Length)
+{
+    ring_buffer_shm_header *header = rbsm_handle->header ;
+    uint32_t chapter_head = atomic_load_explicit(&header->chapter_head, memory_order_acquire);
+    uint32_t chapter_tail = atomic_load_explicit(&header->chapter_tail, memory_order_relaxed);
+    if(chapter_tail - chapter_head >= header->chapter_size)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    if(Length > RBSM_Get_Base_Free_Size(rbsm_handle))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)向当前尾分段写入指定长度数据，结尾前对消费者不可见
+ * \param[out] rbsm_handle: 进程内句柄
+ * \param[in] input_addr: 待写入数据的基地址
+ * \param[in] write_Length: 要写入的字节数
+ * \return 返回写入结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 写入失败，数据数组或分段记录空间不足
+*/
+uint8_t RBSM_Write_String(ring_buffer_shm *rbsm_handle, uint8_t *input_addr, uint32_t write_Length)
+{
+    ring_buffer_region region ;
+    if(!RBSM_Check_Writable(rbsm_handle, write_Length))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    RBSM_Make_Region(rbsm_handle, rbsm_handle->tail, write_Length, &region);
+    RB_COPY_IN(region.addr_a, input_addr, region.Length_a);
+    if(region.Length_b)
+        RB_COPY_IN(region.addr_b, input_addr + region.Length_a, region.Length_b);
+    rbsm_handle->tail += write_Length ;
+    rbsm_handle->tail_chapter_length += write_Length ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)预留尾分段之后指定长度的可写区域，供调用者直接写入共享内存
+ * \param[in] rbsm_handle: 进程内句柄
+ * \param[in] reserve_Length: 需要预留的字节数
+ * \param[out] region: 预留区域的描述，跨越数组末尾时分为a、b两段
+ * \return 返回预留结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 预留成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 预留失败
+*/
+uint8_t RBSM_Write_Reserve(ring_buffer_shm *rbsm_handle, uint32_t reserve_Length, ring_buffer_region *region)
+{
+    if(!RBSM_Check_Writable(rbsm_handle, reserve_Length))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    RBSM_Make_Region(rbsm_handle, rbsm_handle->tail, reserve_Length, region);
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)提交已直接写入预留区域的数据，计入当前尾分段
+ * \param[out] rbsm_handle: 进程内句柄
+ * \param[in] commit_Length: 实际写入的字节数
+ * \return 返回提交结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 提交成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 提交失败
+*/
+uint8_t RBSM_Write_Commit(ring_buffer_shm *rbsm_handle, uint32_t commit_Length)
+{
+    if(!RBSM_Check_Writable(rbsm_handle, commit_Length))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    rbsm_handle->tail += commit_Length ;
+    rbsm_handle->tail_chapter_length += commit_Length ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)分段结尾，写入分段记录后发布 chapter_tail，分段对消费者可见
+ * \param[out] rbsm_handle: 进程内句柄
+ * \return 返回保存结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 保存成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 保存失败，尾分段没有数据或分段记录空间不足
+*/
+uint8_t RBSM_Ending_Chapter(ring_buffer_shm *rbsm_handle)
+{
+    ring_buffer_shm_header *header = rbsm_handle->header ;
+    if(!rbsm_handle->tail_chapter_length)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    uint32_t chapter_tail = atomic_load_explicit(&header->chapter_tail, memory_order_relaxed);
+    if(chapter_tail - atomic_load_explicit(&header->chapter_head, memory_order_acquire) >= header->chapter_size)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    rbsm_handle->chapter_addr[chapter_tail & (header->chapter_size - 1)] = rbsm_handle->tail ;
+    //提交点：消费者看到新的 chapter_tail 时，分段记录与数据均已写入
+    atomic_store_explicit(&header->chapter_tail, chapter_tail + 1, memory_order_release);
+    rbsm_handle->tail_chapter_length = 0 ;
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief 获取已提交(已结尾)的分段数量
+ * \param[in] rbsm_handle: 进程内句柄
+ * \return 返回已提交的分段数量
+*/
+uint32_t RBSM_Get_Chapter_Number(ring_buffer_shm *rbsm_handle)
+{
+    uint32_t chapter_head = atomic_load_explicit(&rbsm_handle->header->chapter_head, memory_order_acquire);
+    return atomic_load_explicit(&rbsm_handle->header->chapter_tail, memory_order_acquire) - chapter_head ;
+}
+
+//(消费者)释放到第 chapter_head + chapter_number 个分段为止，先写 head 再写 chapter_head
+static void RBSM_Release(ring_buffer_shm *rbsm_handle, uint32_t chapter_head, uint32_t chapter_number)
+{
+    ring_buffer_shm_header *header = rbsm_handle->header ;
+    uint32_t end = rbsm_handle->chapter_addr[(chapter_head + chapter_number - 1) & (header->chapter_size - 1)];
+    atomic_store_explicit(&header->head, end, memory_order_release);
+    atomic_store_explicit(&header->chapter_head, chapter_head + chapter_number, memory_order_release);
+}
+
+/**
+ * \brief (消费者)获取头分段数据所在的共享内存区域，不拷贝数据
+ * \param[in] rbsm_handle: 进程内句柄
+ * \param[out] region: 头分段数据区域的描述，跨越数组末尾时分为a、b两段
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 获取成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 获取失败，没有已提交的分段
+ * \note 处理完成后调用 RBSM_Delete(rbsm_handle, 1) 释放头分段
+*/
+uint8_t RBSM_Peek_Chapter(ring_buffer_shm *rbsm_handle, ring_buffer_region *region)
+{
+    ring_buffer_shm_header *header = rbsm_handle->header ;
+    uint32_t chapter_head = atomic_load_explicit(&header->chapter_head, memory_order_relaxed);
+    if(chapter_head == atomic_load_explicit(&header->chapter_tail, memory_order_acquire))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    uint32_t head = atomic_load_explicit(&header->head, memory_order_relaxed);
+    uint32_t end = rbsm_handle->chapter_addr[chapter_head & (header->chapter_size - 1)];
+    RBSM_Make_Region(rbsm_handle, head, end - head, region);
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief (消费者)读取完整的头分段数据
+ * \param[out] rbsm_handle: 进程内句柄
+ * \param[in] output_addr: 读取的分段数据保存地址
+ * \param[out] output_Length: 读取的分段数据长度保存地址，可为NULL
+ * \return 返回读取结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 读取失败，没有已提交的分段
+*/
+uint8_t RBSM_Read_Chapter(ring_buffer_shm *rbsm_handle, uint8_t *output_addr, uint32_t *output_Length)
+{
+    ring_buffer_region region ;
+    if(!RBSM_Peek_Chapter(rbsm_handle, &region))
+        return RING_BUFFER_CHAPTER_ERROR ;
+    memcpy(output_addr, region.addr_a, region.Length_a);
+    if(region.Length_b)
+        memcpy(output_addr + region.Length_a, region.addr_b, region.Length_b);
+    if(output_Length != NULL)
+        *output_Length = region.Length_a + region.Length_b ;
+    RBSM_Release(rbsm_handle, atomic_load_explicit(&rbsm_handle->header->chapter_head, memory_order_relaxed), 1);
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
+
+/**
+ * \brief (消费者)从头分段开始删除指定数量的分段
+ * \param[out] rbsm_handle: 进程内句柄
+ * \param[in] chapter_number: 需要删除的分段数量
+ * \return 返回删除结果
+ *      \arg RING_BUFFER_CHAPTER_SUCCESS: 删除成功
+ *      \arg RING_BUFFER_CHAPTER_ERROR: 删除失败
+*/
+uint8_t RBSM_Delete(ring_buffer_shm *rbsm_handle, uint32_t chapter_number)
+{
+    ring_buffer_shm_header *header = rbsm_handle->header ;
+    uint32_t chapter_head = atomic_load_explicit(&header->chapter_head, memory_order_relaxed);
+    uint32_t chapter_tail = atomic_load_explicit(&header->chapter_tail, memory_order_acquire);
+    if(!chapter_number || chapter_tail - chapter_head < chapter_number)
+        return RING_BUFFER_CHAPTER_ERROR ;
+    RBSM_Release(rbsm_handle, chapter_head, chapter_number);
+    return RING_BUFFER_CHAPTER_SUCCESS ;
+}
@@ -0,0 +1,72 @@
+/**
+ * \file ring_buffer_shm.h
+ * \brief 跨进程共享内存分段环形缓冲相关定义与声明(POSIX)
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_SHM_H_
+#define _RING_BUFFER_SHM_H_
+
+#include <stdint.h>
+#include "ring_buffer.h"
+#include "ring_buffer_chapter.h"
+#include "ring_buffer_atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RBSM_MAGIC              0x4D534252  //共享段标识 "RBSM"
+#define RBSM_VERSION            1           //共享段布局版本
+
+//共享段头部，与分段记录数组、数据数组一起放在同一块共享内存中
+//头部只保存偏移与绝对位置，不保存任何指针，各进程映射到不同地址时均可使用
+//绝对位置为自创建以来累计写入的字节数(按 uint32_t 自然溢出)，分段记录为每个分段结束处的绝对位置
+typedef struct
+{
+    //创建后只读的布局参数，magic 最后写入，打开时据此判断段是否已初始化完成
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) magic ;
+    uint32_t version ;
+    uint32_t base_size ;                //数据数组空间，2的幂
+    uint32_t chapter_size ;             //可记录的分段数量，2的幂
+    uint32_t chapter_offset ;           //分段记录数组相对段起始的偏移
+    uint32_t base_offset ;              //数据数组相对段起始的偏移
+    //生产者写入：已提交的分段数量，是生产者唯一的提交点，分段记录与数据在此之前写入
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) chapter_tail ;
+    //消费者写入：已释放数据的绝对位置，以及已释放的分段数量
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) head ;
+    RB_ATOMIC(uint32_t) chapter_head ;
+}ring_buffer_shm_header;
+
+//进程内句柄，指向本进程映射的共享段
+typedef struct
+{
+    ring_buffer_shm_header *header ;    //共享段头部
+    uint32_t *chapter_addr ;            //本进程映射的分段记录数组地址
+    uint8_t *array_addr ;               //本进程映射的数据数组地址
+    uint32_t map_size ;                 //映射长度
+    uint32_t tail ;                     //(生产者)已写入数据的绝对位置，含尚未结尾的尾分段
+    uint32_t tail_chapter_length ;      //(生产者)当前尾分段暂存字节计数，未结尾前对消费者不可见
+}ring_buffer_shm;
+
+uint8_t RBSM_Create(ring_buffer_shm *rbsm_handle, const char *name, uint32_t base_size, uint32_t chapter_size); //创建并映射共享段
+uint8_t RBSM_Open(ring_buffer_shm *rbsm_handle, const char *name);                                           //映射已存在的共享段，并恢复崩溃前的一致状态
+uint8_t RBSM_Close(ring_buffer_shm *rbsm_handle);                                                            //解除映射，共享段保留
+uint8_t RBSM_Unlink(const char *name);                                                                       //删除共享段
+uint8_t RBSM_Write_String(ring_buffer_shm *rbsm_handle, uint8_t *input_addr, uint32_t write_Length);         //(生产者)向尾分段里写指定长度数据
+uint8_t RBSM_Write_Reserve(ring_buffer_shm *rbsm_handle, uint32_t reserve_Length, ring_buffer_region *region); //(生产者)预留尾分段之后指定长度的可写区域
+uint8_t RBSM_Write_Commit(ring_buffer_shm *rbsm_handle, uint32_t commit_Length);                             //(生产者)提交已直接写入预留区域的数据
+uint8_t RBSM_Ending_Chapter(ring_buffer_shm *rbsm_handle);                                                   //(生产者)分段结尾，对消费者可见
+uint8_t RBSM_Read_Chapter(ring_buffer_shm *rbsm_handle, uint8_t *output_addr, uint32_t *output_Length);      //(消费者)读取整个头分段
+uint8_t RBSM_Peek_Chapter(ring_buffer_shm *rbsm_handle, ring_buffer_region *region);                         //(消费者)获取头分段数据所在区域(不拷贝)
+uint8_t RBSM_Delete(ring_buffer_shm *rbsm_handle, uint32_t chapter_number);                                  //(消费者)从头分段开始删除指定数量的分段
+uint32_t RBSM_Get_Chapter_Number(ring_buffer_shm *rbsm_handle);                                              //获取已提交的分段数量
+uint32_t RBSM_Get_Base_Free_Size(ring_buffer_shm *rbsm_handle);                                              //(生产者)获取数据数组剩余可用空间
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_SHM_H_
@@ -0,0 +1,586 @@
+/**
+ * \file ring_buffer_spsc.c
+ * \brief 单生产者单消费者无锁环形缓冲的实现
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+#include <stdint.h>
+#include <string.h>
+#include "ring_buffer_spsc.h"
+#include "ring_buffer_copy.h"
+#if RING_BUFFER_SPSC_WAIT
+#include <time.h>
+#include <sched.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+#endif
+
+#if RING_BUFFER_SPSC_WAIT
+//自旋等待时降低功耗与对另一个超线程的干扰
+static inline void RBS_Cpu_Relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+//在 address 的值仍为 expected 时挂起线程，最长 timeout_ns 纳秒，非 Linux 平台退化为让出时间片
+static void RBS_Futex_Wait(_Atomic uint32_t *address, uint32_t expected, uint64_t timeout_ns)
+{
+#ifdef __linux__
+    struct timespec timeout ;
+    timeout.tv_sec = (time_t)(timeout_ns / 1000000000u);
+    timeout.tv_nsec = (long)(timeout_ns % 1000000000u);
+    syscall(SYS_futex, (uint32_t *)address, FUTEX_WAIT_PRIVATE, expected, &timeout, NULL, 0);
+#else
+    (void)address ; (void)expected ; (void)timeout_ns ;
+    sched_yield();
+#endif
+}
+
+//唤醒挂起在 address 上的线程
+static void RBS_Futex_Wake(_Atomic uint32_t *address)
+{
+#ifdef __linux__
+    syscall(SYS_futex, (uint32_t *)address, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#else
+    (void)address ;
+#endif
+}
+
+//获取单调时钟的纳秒数
+static uint64_t RBS_Now(void)
+{
+    struct timespec ts ;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec ;
+}
+#endif
+
+//指针位置转换为数组下标
+static inline uint32_t RBS_Index(ring_buffer_spsc *rb_handle, uint32_t position)
+{
+    return (position >= rb_handle->max_Length) ? (position - rb_handle->max_Length) : position ;
+}
+
+//指针向前推进指定长度，在 [0, 2*max_Length) 范围内回绕
+static inline uint32_t RBS_Advance(ring_buffer_spsc *rb_handle, uint32_t position, uint32_t Length)
+{
+    uint32_t remain = 2 * rb_handle->max_Length - position ;
+    return (Length >= remain) ? (Length - remain) : (position + Length) ;
+}
+
+//计算两指针之间的数据量
+static inline uint32_t RBS_Distance(ring_buffer_spsc *rb_handle, uint32_t head, uint32_t tail)
+{
+    return (tail >= head) ? (tail - head) : (2 * rb_handle->max_Length - (head - tail)) ;
+}
+
+//(生产者)发布新的写指针，阻塞模式下只有消费者已挂起等待时才发起唤醒
+static inline void RBS_Publish_Tail(ring_buffer_spsc *rb_handle, uint32_t tail)
+{
+    atomic_store_explicit(&rb_handle->tail, tail, memory_order_release);
+#if RING_BUFFER_SPSC_WAIT
+    //非阻塞模式下没有挂起的线程，省去全屏障与对等待标志缓存行的访问
+    if(!(rb_handle->flags & RING_BUFFER_SPSC_FLAG_BLOCKING))
+        return ;
+    //与等待方的"先置标志再检查指针"配对，保证两者至少有一方看到对方的修改；
+    //等待标志只由等待方自己清除，唤醒方清除会覆盖等待方刚刚重新置位的标志，使其错过之后的唤醒
+    atomic_thread_fence(memory_order_seq_cst);
+    if(atomic_load_explicit(&rb_handle->read_waiting, memory_order_relaxed))
+        RBS_Futex_Wake(&rb_handle->tail);
+#endif
+}
+
+//(消费者)发布新的读指针，阻塞模式下只有生产者已挂起等待时才发起唤醒
+static inline void RBS_Publish_Head(ring_buffer_spsc *rb_handle, uint32_t head)
+{
+    atomic_store_explicit(&rb_handle->head, head, memory_order_release);
+#if RING_BUFFER_SPSC_WAIT
+    if(!(rb_handle->flags & RING_BUFFER_SPSC_FLAG_BLOCKING))
+        return ;
+    atomic_thread_fence(memory_order_seq_cst);
+    if(atomic_load_explicit(&rb_handle->write_waiting, memory_order_relaxed))
+        RBS_Futex_Wake(&rb_handle->head);
+#endif
+}
+
+#ifdef RING_BUFFER_STATS
+//统计计数器只由一侧线程修改，使用 relaxed 读取加写入即可，不需要带锁的原子加法
+static inline void RBS_Stats_Add(_Atomic uint64_t *counter, uint64_t number)
+{
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + number, memory_order_relaxed);
+}
+
+//(生产者)记录一次写入，占用量按生产者缓存的读指针计算，是实际占用量的上界，不额外读取消费者缓存行
+static void RBS_Stats_Write(ring_buffer_spsc *rb_handle, uint32_t tail, uint32_t Length)
+{
+    ring_buffer_spsc_stats *stats = rb_handle->stats ;
+    uint32_t stored = RBS_Distance(rb_handle, rb_handle->head_cache, tail) + Length ;
+    uint32_t bucket = 0 ;
+    for(uint32_t value = stored; value; value >>= 1)
+        bucket ++ ;
+    RBS_Stats_Add(&stats->bytes_in, Length);
+    if(Length > rb_handle->max_Length - RBS_Index(rb_handle, tail))
+        RBS_Stats_Add(&stats->wrap_in, 1);
+    if(stored > atomic_load_explicit(&stats->high_water, memory_order_relaxed))
+        atomic_store_explicit(&stats->high_water, stored, memory_order_relaxed);
+    RBS_Stats_Add(&stats->histogram[bucket], 1);
+}
+
+//(消费者)记录一次读出或删除，copy 为0时表示删除
+static void RBS_Stats_Read(ring_buffer_spsc *rb_handle, uint32_t head, uint32_t Length, uint8_t copy)
+{
+    RBS_Stats_Add(&rb_handle->stats->bytes_out, Length);
+    if(copy && Length > rb_handle->max_Length - RBS_Index(rb_handle, head))
+        RBS_Stats_Add(&rb_handle->stats->wrap_out, 1);
+}
+
+//未挂接统计数据时只多一次指针判断，指针位于初始化后只读的缓存行
+#define RBS_STATS_WRITE(rb_handle, tail, Length)        do{ if((rb_handle)->stats) RBS_Stats_Write(rb_handle, tail, Length); }while(0)
+#define RBS_STATS_READ(rb_handle, head, Length, copy)   do{ if((rb_handle)->stats) RBS_Stats_Read(rb_handle, head, Length, copy); }while(0)
+#define RBS_STATS_REJECT(rb_handle)                     do{ if((rb_handle)->stats) RBS_Stats_Add(&(rb_handle)->stats->write_rejected, 1); }while(0)
+#else
+#define RBS_STATS_WRITE(rb_handle, tail, Length)        ((void)0)
+#define RBS_STATS_READ(rb_handle, head, Length, copy)   ((void)0)
+#define RBS_STATS_REJECT(rb_handle)                     ((void)0)
+#endif
+
+/**
+ * \brief 初始化无锁环形缓冲区
+ * \param[out] rb_handle: 待初始化的缓冲区结构体句柄
+ * \param[in] buffer_addr: 外部定义的缓冲区数组，类型必须为 uint8_t
+ * \param[in] buffer_size: 外部定义的缓冲区数组空间
+ * \return 返回缓冲区初始化的结果
+ *      \arg RING_BUFFER_SUCCESS: 初始化成功
+ *      \arg RING_BUFFER_ERROR: 初始化失败
+ * \note 初始化须在生产者与消费者线程开始访问之前完成
+*/
+uint8_t RBS_Init(ring_buffer_spsc *rb_handle, uint8_t *buffer_addr, uint32_t buffer_size)
+{
+    //指针取值范围为两倍数组空间，数组空间必须大于2且不超过 0x7FFFFFFF
+    if(buffer_size < 2 || buffer_size > 0x7FFFFFFF)
+        return RING_BUFFER_ERROR ;
+    atomic_init(&rb_handle->tail, 0);
+    atomic_init(&rb_handle->head, 0);
+    atomic_init(&rb_handle->read_waiting, 0);
+    atomic_init(&rb_handle->write_waiting, 0);
+    rb_handle->head_cache = 0 ;
+    rb_handle->tail_cache = 0 ;
+    rb_handle->array_addr = buffer_addr ;
+    rb_handle->max_Length = buffer_size ;
+    rb_handle->flags = 0 ;
+    rb_handle->stats = NULL ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (消费者)从头指针开始删除指定长度的数据
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] Length: 要删除的长度
+ * \return 返回删除指定长度数据结果
+ *      \arg RING_BUFFER_SUCCESS: 删除成功
+ *      \arg RING_BUFFER_ERROR: 删除失败
+*/
+uint8_t RBS_Delete(ring_buffer_spsc *rb_handle, uint32_t Length)
+{
+    uint32_t head = atomic_load_explicit(&rb_handle->head, memory_order_relaxed);
+    //先使用缓存的写指针判断，数据不足时再重新获取生产者的写指针
+    if(RBS_Distance(rb_handle, head, rb_handle->tail_cache) < Length)
+    {
+        rb_handle->tail_cache = atomic_load_explicit(&rb_handle->tail, memory_order_acquire);
+        if(RBS_Distance(rb_handle, head, rb_handle->tail_cache) < Length)
+            return RING_BUFFER_ERROR ;//已储存的数据量小于需删除的数据量
+    }
+    RBS_STATS_READ(rb_handle, head, Length, 0);
+    RBS_Publish_Head(rb_handle, RBS_Advance(rb_handle, head, Length));
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)向缓冲区尾部写一个字节
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] data: 要写入的字节
+ * \return 返回缓冲区写字节的结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 写入失败
+*/
+uint8_t RBS_Write_Byte(ring_buffer_spsc *rb_handle, uint8_t data)
+{
+    uint32_t tail = atomic_load_explicit(&rb_handle->tail, memory_order_relaxed);
+    //缓冲区数组已满时重新获取消费者的读指针，仍然已满则产生覆盖错误
+    if(RBS_Distance(rb_handle, rb_handle->head_cache, tail) == rb_handle->max_Length)
+    {
+        rb_handle->head_cache = atomic_load_explicit(&rb_handle->head, memory_order_acquire);
+        if(RBS_Distance(rb_handle, rb_handle->head_cache, tail) == rb_handle->max_Length)
+        {
+            RBS_STATS_REJECT(rb_handle);
+            return RING_BUFFER_ERROR ;
+        }
+    }
+    RBS_STATS_WRITE(rb_handle, tail, 1);
+    *(rb_handle->array_addr + RBS_Index(rb_handle, tail)) = data ;//基地址+偏移量，存放数据
+    //发布新的写指针，保证消费者看到指针时数据已经写入
+    RBS_Publish_Tail(rb_handle, RBS_Advance(rb_handle, tail, 1));
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (消费者)从缓冲区头指针读取一个字节
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[out] output_addr: 读取的字节保存地址
+ * \return 返回读取状态
+ *      \arg RING_BUFFER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_ERROR: 读取失败
+*/
+uint8_t RBS_Read_Byte(ring_buffer_spsc *rb_handle, uint8_t *output_addr)
+{
+    uint32_t head = atomic_load_explicit(&rb_handle->head, memory_order_relaxed);
+    if(head == rb_handle->tail_cache)
+    {
+        rb_handle->tail_cache = atomic_load_explicit(&rb_handle->tail, memory_order_acquire);
+        if(head == rb_handle->tail_cache)
+            return RING_BUFFER_ERROR ;//没有可读数据
+    }
+    RBS_STATS_READ(rb_handle, head, 1, 1);
+    *output_addr = *(rb_handle->array_addr + RBS_Index(rb_handle, head));//读取数据
+    //发布新的读指针，释放该字节空间给生产者
+    RBS_Publish_Head(rb_handle, RBS_Advance(rb_handle, head, 1));
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (生产者)向缓冲区尾部写指定长度的数据
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] input_addr: 待写入数据的基地址
+ * \param[in] write_Length: 要写入的字节数
+ * \return 返回缓冲区尾部写指定长度字节的结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 写入失败
+*/
+uint8_t RBS_Write_String(ring_buffer_spsc *rb_handle, uint8_t *input_addr, uint32_t write_Length)
+{
+    uint32_t tail = atomic_load_explicit(&rb_handle->tail, memory_order_relaxed);
+    //如果不够存储空间存放新数据,重新获取读指针后再判断一次
+    if(rb_handle->max_Length - RBS_Distance(rb_handle, rb_handle->head_cache, tail) < write_Length)
+    {
+        rb_handle->head_cache = atomic_load_explicit(&rb_handle->head, memory_order_acquire);
+        if(rb_handle->max_Length - RBS_Distance(rb_handle, rb_handle->head_cache, tail) < write_Length)
+        {
+            RBS_STATS_REJECT(rb_handle);
+            return RING_BUFFER_ERROR ;
+        }
+    }
+    RBS_STATS_WRITE(rb_handle, tail, write_Length);
+    uint32_t index = RBS_Index(rb_handle, tail);
+    //如果顺序可用长度小于需写入的长度，需要将数据拆成两次分别写入
+    if((rb_handle->max_Length - index) < write_Length)
+    {
+        uint32_t write_size_a = rb_handle->max_Length - index ;
+        RB_COPY_IN(rb_handle->array_addr + index, input_addr, write_size_a);
+        RB_COPY_IN(rb_handle->array_addr, input_addr + write_size_a, write_Length - write_size_a);
+    }
+    else RB_COPY_IN(rb_handle->array_addr + index, input_addr, write_Length);
+    RBS_Publish_Tail(rb_handle, RBS_Advance(rb_handle, tail, write_Length));
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief (消费者)从缓冲区头部读指定长度的数据，保存到指定的地址
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[out] output_addr: 读取的数据保存地址
+ * \param[in] read_Length: 要读取的字节数
+ * \return 返回缓冲区头部读指定长度字节的结果
+ *      \arg RING_BUFFER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_ERROR: 读取失败
+*/
+uint8_t RBS_Read_String(ring_buffer_spsc *rb_handle, uint8_t *output_addr, uint32_t read_Length)
+{
+    uint32_t head = atomic_load_explicit(&rb_handle->head, memory_order_relaxed);
+    if(RBS_Distance(rb_handle, head, rb_handle->tail_cache) < read_Length)
+    {
+        rb_handle->tail_cache = atomic_load_explicit(&rb_handle->tail, memory_order_acquire);
+        if(RBS_Distance(rb_handle, head, rb_handle->tail_cache) < read_Length)
+            return RING_BUFFER_ERROR ;
+    }
+    RBS_STATS_READ(rb_handle, head, read_Length, 1);
+    uint32_t index = RBS_Index(rb_handle, head);
+    if(read_Length > (rb_handle->max_Length - index))
+    {
+        uint32_t Read_size_a = rb_handle->max_Length - index ;
+        memcpy(output_addr, rb_handle->array_addr + index, Read_size_a);
+        memcpy(output_addr + Read_size_a, rb_handle->array_addr, read_Length - Read_size_a);
+    }
+    else memcpy(output_addr, rb_handle->array_addr + index, read_Length);
+    RBS_Publish_Head(rb_handle, RBS_Advance(rb_handle, head, read_Length));
+    return RING_BUFFER_SUCCESS ;
+}
+
+#if RING_BUFFER_SPSC_WAIT
+/**
+ * \brief 开启或关闭阻塞模式，开启后 RBS_*_Wait 在自旋之后可挂起线程，由对方发布指针时唤醒
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] enable: 1 开启，0 关闭
+ * \return 返回设置结果
+ *      \arg RING_BUFFER_SUCCESS: 设置成功
+ * \note 须在生产者与消费者线程开始访问之前设置；阻塞模式下每次发布指针多一次全屏障与等待标志检查，
+ *       未开启时 RBS_*_Wait 在自旋之后以让出时间片的方式轮询
+*/
+uint8_t RBS_Set_Blocking(ring_buffer_spsc *rb_handle, uint8_t enable)
+{
+    if(enable)
+        rb_handle->flags |= RING_BUFFER_SPSC_FLAG_BLOCKING ;
+    else
+        rb_handle->flags &= (uint8_t)~RING_BUFFER_SPSC_FLAG_BLOCKING ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/*
+ * 阻塞等待：先自旋 RB_SPSC_SPIN_COUNT 次，条件仍不满足时置位等待标志，
+ * 再次确认条件后挂起在对方的指针上(futex)，对方发布指针时检查到标志才发起唤醒；
+ * 未开启阻塞模式时对方不会发起唤醒，自旋之后改为让出时间片轮询
+*/
+
+//等待 position 所指的对方指针使 check 条件成立，deadline 为0时一直等待
+static uint8_t RBS_Wait(ring_buffer_spsc *rb_handle, _Atomic uint32_t *position, _Atomic uint32_t *waiting,\
+                        uint8_t (*check)(ring_buffer_spsc *, uint32_t, uint32_t), uint32_t Length, uint32_t timeout_ms)
+{
+    for(uint32_t i = 0; i < RB_SPSC_SPIN_COUNT; i++)
+    {
+        if(check(rb_handle, atomic_load_explicit(position, memory_order_acquire), Length))
+            return RING_BUFFER_SUCCESS ;
+        RBS_Cpu_Relax();
+    }
+    uint64_t deadline = (timeout_ms == RB_SPSC_WAIT_FOREVER) ? 0 : RBS_Now() + (uint64_t)timeout_ms * 1000000u ;
+    if(!(rb_handle->flags & RING_BUFFER_SPSC_FLAG_BLOCKING))
+    {
+        while(!check(rb_handle, atomic_load_explicit(position, memory_order_acquire), Length))
+        {
+            if(deadline && RBS_Now() >= deadline)
+                return RING_BUFFER_ERROR ;//等待超时
+            sched_yield();
+        }
+        return RING_BUFFER_SUCCESS ;
+    }
+    while(1)
+    {
+        atomic_store_explicit(waiting, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        uint32_t observed = atomic_load_explicit(position, memory_order_acquire);
+        if(check(rb_handle, observed, Length))
+        {
+            atomic_store_explicit(waiting, 0, memory_order_relaxed);
+            return RING_BUFFER_SUCCESS ;
+        }
+        uint64_t timeout_ns = 1000000000u ;
+        if(deadline)
+        {
+            uint64_t now = RBS_Now();
+            if(now >= deadline)
+            {
+                atomic_store_explicit(waiting, 0, memory_order_relaxed);
+                return RING_BUFFER_ERROR ;//等待超时
+            }
+            timeout_ns = deadline - now ;
+        }
+        RBS_Futex_Wait(position, observed, timeout_ns);
+    }
+}
+
+//消费者等待条件：可读数据不少于 Length
+static uint8_t RBS_Check_Readable(ring_buffer_spsc *rb_handle, uint32_t tail, uint32_t Length)
+{
+    uint32_t head = atomic_load_explicit(&rb_handle->head, memory_order_relaxed);
+    return RBS_Distance(rb_handle, head, tail) >= Length ;
+}
+
+//生产者等待条件：可用空间不少于 Length
+static uint8_t RBS_Check_Writable(ring_buffer_spsc *rb_handle, uint32_t head, uint32_t Length)
+{
+    uint32_t tail = atomic_load_explicit(&rb_handle->tail, memory_order_relaxed);
+    return rb_handle->max_Length - RBS_Distance(rb_handle, head, tail) >= Length ;
+}
+
+/**
+ * \brief (消费者)等待直到可读数据不少于指定长度
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \param[in] Length: 需要的数据长度，不能超过数组空间
+ * \param[in] timeout_ms: 超时时间(毫秒)，RB_SPSC_WAIT_FOREVER 表示一直等待
+ * \return 返回等待结果
+ *      \arg RING_BUFFER_SUCCESS: 条件已满足
+ *      \arg RING_BUFFER_ERROR: 等待超时或参数错误
+*/
+uint8_t RBS_Wait_Readable(ring_buffer_spsc *rb_handle, uint32_t Length, uint32_t timeout_ms)
+{
+    if(Length > rb_handle->max_Length)
+        return RING_BUFFER_ERROR ;
+    return RBS_Wait(rb_handle, &rb_handle->tail, &rb_handle->read_waiting, RBS_Check_Readable, Length, timeout_ms);
+}
+
+/**
+ * \brief (生产者)等待直到可用空间不少于指定长度
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \param[in] Length: 需要的空间长度，不能超过数组空间
+ * \param[in] timeout_ms: 超时时间(毫秒)，RB_SPSC_WAIT_FOREVER 表示一直等待
+ * \return 返回等待结果
+ *      \arg RING_BUFFER_SUCCESS: 条件已满足
+ *      \arg RING_BUFFER_ERROR: 等待超时或参数错误
+*/
+uint8_t RBS_Wait_Writable(ring_buffer_spsc *rb_handle, uint32_t Length, uint32_t timeout_ms)
+{
+    if(Length > rb_handle->max_Length)
+        return RING_BUFFER_ERROR ;
+    return RBS_Wait(rb_handle, &rb_handle->head, &rb_handle->write_waiting, RBS_Check_Writable, Length, timeout_ms);
+}
+
+/**
+ * \brief (生产者)向缓冲区尾部写指定长度的数据，空间不足时等待
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] input_addr: 待写入数据的基地址
+ * \param[in] write_Length: 要写入的字节数
+ * \param[in] timeout_ms: 超时时间(毫秒)，RB_SPSC_WAIT_FOREVER 表示一直等待
+ * \return 返回写入结果
+ *      \arg RING_BUFFER_SUCCESS: 写入成功
+ *      \arg RING_BUFFER_ERROR: 等待超时或参数错误
+*/
+uint8_t RBS_Write_String_Wait(ring_buffer_spsc *rb_handle, uint8_t *input_addr, uint32_t write_Length, uint32_t timeout_ms)
+{
+    if(RBS_Write_String(rb_handle, input_addr, write_Length))
+        return RING_BUFFER_SUCCESS ;
+    if(!RBS_Wait_Writable(rb_handle, write_Length, timeout_ms))
+        return RING_BUFFER_ERROR ;
+    return RBS_Write_String(rb_handle, input_addr, write_Length);
+}
+
+/**
+ * \brief (消费者)从缓冲区头部读指定长度的数据，数据不足时等待
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[out] output_addr: 读取的数据保存地址
+ * \param[in] read_Length: 要读取的字节数
+ * \param[in] timeout_ms: 超时时间(毫秒)，RB_SPSC_WAIT_FOREVER 表示一直等待
+ * \return 返回读取结果
+ *      \arg RING_BUFFER_SUCCESS: 读取成功
+ *      \arg RING_BUFFER_ERROR: 等待超时或参数错误
+*/
+uint8_t RBS_Read_String_Wait(ring_buffer_spsc *rb_handle, uint8_t *output_addr, uint32_t read_Length, uint32_t timeout_ms)
+{
+    if(RBS_Read_String(rb_handle, output_addr, read_Length))
+        return RING_BUFFER_SUCCESS ;
+    if(!RBS_Wait_Readable(rb_handle, read_Length, timeout_ms))
+        return RING_BUFFER_ERROR ;
+    return RBS_Read_String(rb_handle, output_addr, read_Length);
+}
+#endif
+
+#ifdef RING_BUFFER_STATS
+/**
+ * \brief 挂接运行统计数据并清零(需定义 RING_BUFFER_STATS 编译)
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \param[in] stats: 外部定义的统计数据，生命周期须覆盖缓冲区的使用期，传入NULL时停止统计
+ * \return 返回挂接结果
+ *      \arg RING_BUFFER_SUCCESS: 挂接成功
+ * \note 须与 RBS_Init 一样在生产者与消费者线程开始访问之前调用
+*/
+uint8_t RBS_Set_Stats(ring_buffer_spsc *rb_handle, ring_buffer_spsc_stats *stats)
+{
+    if(stats != NULL)
+    {
+        atomic_init(&stats->bytes_in, 0);
+        atomic_init(&stats->write_rejected, 0);
+        atomic_init(&stats->wrap_in, 0);
+        atomic_init(&stats->high_water, 0);
+        for(uint32_t i = 0; i < RING_BUFFER_STATS_HISTOGRAM; i++)
+            atomic_init(&stats->histogram[i], 0);
+        atomic_init(&stats->bytes_out, 0);
+        atomic_init(&stats->wrap_out, 0);
+    }
+    rb_handle->stats = stats ;
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 获取运行统计(需定义 RING_BUFFER_STATS 编译)，合并生产者与消费者两侧的计数
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \param[out] output_stats: 统计数据保存地址
+ * \return 返回获取结果
+ *      \arg RING_BUFFER_SUCCESS: 获取成功
+ *      \arg RING_BUFFER_ERROR: 获取失败，未挂接统计数据
+ * \note 可在任意线程调用，各计数器分别读取，结果为近似快照；wrap_split 为读写两侧拆分次数之和
+*/
+uint8_t RBS_Get_Stats(ring_buffer_spsc *rb_handle, ring_buffer_stats *output_stats)
+{
+    ring_buffer_spsc_stats *stats = rb_handle->stats ;
+    if(stats == NULL)
+        return RING_BUFFER_ERROR ;
+    output_stats->bytes_in = atomic_load_explicit(&stats->bytes_in, memory_order_relaxed);
+    output_stats->bytes_out = atomic_load_explicit(&stats->bytes_out, memory_order_relaxed);
+    output_stats->write_rejected = atomic_load_explicit(&stats->write_rejected, memory_order_relaxed);
+    output_stats->wrap_split = atomic_load_explicit(&stats->wrap_in, memory_order_relaxed)\
+                             + atomic_load_explicit(&stats->wrap_out, memory_order_relaxed);
+    output_stats->high_water = atomic_load_explicit(&stats->high_water, memory_order_relaxed);
+    for(uint32_t i = 0; i < RING_BUFFER_STATS_HISTOGRAM; i++)
+        output_stats->occupancy_histogram[i] = atomic_load_explicit(&stats->histogram[i], memory_order_relaxed);
+    return RING_BUFFER_SUCCESS ;
+}
+
+/**
+ * \brief 清零运行统计(需定义 RING_BUFFER_STATS 编译)
+ * \param[out] rb_handle: 缓冲区结构体句柄
+ * \return 返回清零结果
+ *      \arg RING_BUFFER_SUCCESS: 清零成功
+ *      \arg RING_BUFFER_ERROR: 清零失败，未挂接统计数据
+ * \note 可在任意线程调用；计数器由读写线程以读取加写入的方式累加，
+ *       与读写并发清零时个别计数可能保留清零前的值，需要精确清零时应在读写暂停期间调用
+*/
+uint8_t RBS_Reset_Stats(ring_buffer_spsc *rb_handle)
+{
+    ring_buffer_spsc_stats *stats = rb_handle->stats ;
+    if(stats == NULL)
+        return RING_BUFFER_ERROR ;
+    atomic_store_explicit(&stats->bytes_in, 0, memory_order_relaxed);
+    atomic_store_explicit(&stats->write_rejected, 0, memory_order_relaxed);
+    atomic_store_explicit(&stats->wrap_in, 0, memory_order_relaxed);
+    atomic_store_explicit(&stats->high_water, 0, memory_order_relaxed);
+    for(uint32_t i = 0; i < RING_BUFFER_STATS_HISTOGRAM; i++)
+        atomic_store_explicit(&stats->histogram[i], 0, memory_order_relaxed);
+    atomic_store_explicit(&stats->bytes_out, 0, memory_order_relaxed);
+    atomic_store_explicit(&stats->wrap_out, 0, memory_order_relaxed);
+    return RING_BUFFER_SUCCESS ;
+}
+#endif
+
+/**
+ * \brief 获取缓冲区里已储存的数据长度
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \return 返回缓冲区里已储存的数据长度
+ * \note 在另一侧线程并发操作时，返回值仅为调用瞬间的快照
+*/
+uint32_t RBS_Get_Length(ring_buffer_spsc *rb_handle)
+{
+    uint32_t head = atomic_load_explicit(&rb_handle->head, memory_order_acquire);
+    uint32_t tail = atomic_load_explicit(&rb_handle->tail, memory_order_acquire);
+    uint32_t Length = RBS_Distance(rb_handle, head, tail);
+    //两次读取之间读指针可能已被消费者推进，结果需限制在数组空间以内
+    return (Length > rb_handle->max_Length) ? rb_handle->max_Length : Length ;
+}
+
+/**
+ * \brief 获取缓冲区可用储存空间
+ * \param[in] rb_handle: 缓冲区结构体句柄
+ * \return 返回缓冲区可用储存空间
+ * \note 在另一侧线程并发操作时，返回值仅为调用瞬间的快照
+*/
+uint32_t RBS_Get_FreeSize(ring_buffer_spsc *rb_handle)
+{
+    return rb_handle->max_Length - RBS_Get_Length(rb_handle) ;
+}
@@ -0,0 +1,106 @@
+/**
+ * \file ring_buffer_spsc.h
+ * \brief 单生产者单消费者无锁环形缓冲相关定义与声明
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v0.5.0
+*/
+
+#ifndef _RING_BUFFER_SPSC_H_
+#define _RING_BUFFER_SPSC_H_
+
+#include <stdint.h>
+#include "ring_buffer.h"
+#include "ring_buffer_atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//阻塞等待接口(RBS_*_Wait、RBS_Set_Blocking)依赖单调时钟与线程调度，Linux 下默认编译，
+//其它提供 POSIX clock_gettime 与 sched_yield 的平台可定义为1启用，定义为0时只编译非阻塞读写
+#ifndef RING_BUFFER_SPSC_WAIT
+#ifdef __linux__
+#define RING_BUFFER_SPSC_WAIT   1
+#else
+#define RING_BUFFER_SPSC_WAIT   0
+#endif
+#endif
+
+#if RING_BUFFER_SPSC_WAIT
+//阻塞读写时自旋等待的次数，超过后挂起线程
+#ifndef RB_SPSC_SPIN_COUNT
+#define RB_SPSC_SPIN_COUNT      1024
+#endif
+
+//阻塞读写的超时参数，表示一直等待
+#define RB_SPSC_WAIT_FOREVER    0xFFFFFFFF
+#endif
+
+//工作模式标志位定义
+#define RING_BUFFER_SPSC_FLAG_BLOCKING      0x01    //阻塞模式：等待方可挂起线程，每次发布指针时检查对方是否需要唤醒
+
+//无锁版运行统计，由调用者定义并通过 RBS_Set_Stats 挂接，句柄布局与是否定义 RING_BUFFER_STATS 无关
+//生产者与消费者侧计数器各占独立缓存行，只由所属线程写入
+struct ring_buffer_spsc_stats ;
+#ifdef RING_BUFFER_STATS
+typedef struct ring_buffer_spsc_stats
+{
+    //生产者侧统计
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint64_t) bytes_in ;
+    RB_ATOMIC(uint64_t) write_rejected ;
+    RB_ATOMIC(uint64_t) wrap_in ;
+    RB_ATOMIC(uint32_t) high_water ;
+    RB_ATOMIC(uint64_t) histogram[RING_BUFFER_STATS_HISTOGRAM] ;
+    //消费者侧统计
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint64_t) bytes_out ;
+    RB_ATOMIC(uint64_t) wrap_out ;
+}ring_buffer_spsc_stats;
+#endif
+
+//无锁环形缓冲区结构体
+//head、tail 取值范围为 [0, 2*max_Length)，二者之差即为已储存的数据量，无需共享的 Length 计数
+typedef struct
+{
+    //生产者独占缓存行
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) tail ;           //写指针，仅生产者修改
+    uint32_t head_cache ;                                               //生产者缓存的读指针副本
+    //消费者独占缓存行
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) head ;           //读指针，仅消费者修改
+    uint32_t tail_cache ;                                               //消费者缓存的写指针副本
+    //挂起等待标志，只在一侧线程挂起时写入，另一侧据此决定是否需要唤醒；未编译阻塞等待接口时保留以固定结构体布局
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) RB_ATOMIC(uint32_t) read_waiting ;   //消费者正在等待数据
+    RB_ATOMIC(uint32_t) write_waiting ;                                 //生产者正在等待空间
+    //初始化后只读的共享参数
+    RB_ALIGNAS(RB_CACHE_LINE_SIZE) uint8_t *array_addr ;                //缓冲区储存数组基地址
+    uint32_t max_Length ;                                               //缓冲区最大可储存数据量
+    uint8_t flags ;                                                     //工作模式标志位
+    struct ring_buffer_spsc_stats *stats ;                              //运行统计，初始化后为NULL，由 RBS_Set_Stats 挂接
+}ring_buffer_spsc;
+
+uint8_t RBS_Init(ring_buffer_spsc *rb_handle, uint8_t *buffer_addr, uint32_t buffer_size);        //初始化无锁环形缓冲区
+uint8_t RBS_Delete(ring_buffer_spsc *rb_handle, uint32_t Length);                                 //(消费者)从头指针开始删除指定长度的数据
+uint8_t RBS_Write_Byte(ring_buffer_spsc *rb_handle, uint8_t data);                                //(生产者)向缓冲区尾指针写一个字节
+uint8_t RBS_Write_String(ring_buffer_spsc *rb_handle, uint8_t *input_addr, uint32_t write_Length);//(生产者)向缓冲区尾指针写指定长度数据
+uint8_t RBS_Read_Byte(ring_buffer_spsc *rb_handle, uint8_t *output_addr);                         //(消费者)从缓冲区头指针读一个字节
+uint8_t RBS_Read_String(ring_buffer_spsc *rb_handle, uint8_t *output_addr, uint32_t read_Length); //(消费者)从缓冲区头指针读指定长度数据
+#if RING_BUFFER_SPSC_WAIT
+uint8_t RBS_Set_Blocking(ring_buffer_spsc *rb_handle, uint8_t enable);                          //开启或关闭阻塞模式
+uint8_t RBS_Wait_Readable(ring_buffer_spsc *rb_handle, uint32_t Length, uint32_t timeout_ms);   //(消费者)等待直到可读数据不少于指定长度
+uint8_t RBS_Wait_Writable(ring_buffer_spsc *rb_handle, uint32_t Length, uint32_t timeout_ms);   //(生产者)等待直到可用空间不少于指定长度
+uint8_t RBS_Write_String_Wait(ring_buffer_spsc *rb_handle, uint8_t *input_addr, uint32_t write_Length, uint32_t timeout_ms); //(生产者)阻塞写指定长度数据
+uint8_t RBS_Read_String_Wait(ring_buffer_spsc *rb_handle, uint8_t *output_addr, uint32_t read_Length, uint32_t timeout_ms);  //(消费者)阻塞读指定长度数据
+#endif
+#ifdef RING_BUFFER_STATS
+uint8_t RBS_Set_Stats(ring_buffer_spsc *rb_handle, ring_buffer_spsc_stats *stats);                //挂接并清零运行统计，传入NULL时停止统计
+uint8_t RBS_Get_Stats(ring_buffer_spsc *rb_handle, ring_buffer_stats *output_stats);               //获取运行统计
+uint8_t RBS_Reset_Stats(ring_buffer_spsc *rb_handle);                                              //清零运行统计
+#endif
+uint32_t RBS_Get_Length(ring_buffer_spsc *rb_handle);                                             //获取缓冲区里已储存的数据长度
+uint32_t RBS_Get_FreeSize(ring_buffer_spsc *rb_handle);                                           //获取缓冲区可用储存空间
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//#ifndef _RING_BUFFER_SPSC_H_